@@ -1,14 +1,23 @@
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "client.h"
+#include "component_cache.h"
 #include "generator.h"
+#include "profile.h"
+#include "scheduler.h"
 #include "server.h"
+#include "session.h"
 
 bool batch_mode = false;
+bool text_protocol = false;  // Pass every map through PrintMap() and ReadMap() as text instead of the in-memory view
 
 /**
  * @brief The implementation of function Execute
@@ -33,6 +42,12 @@ void Execute(int row, int column, int type) {
       return;
     }
   }
+  if (!text_protocol) {
+    // The client reads the server's rendered frame in place, skipping the text round trip below.
+    ReadMapView(RenderedMap());
+    return;
+  }
+  PROFILE_SCOPE(kTimeTextRoundTrip);
   std::ostringstream oss;
   std::streambuf *old_output_buffer = std::cout.rdbuf();
   std::cout.rdbuf(oss.rdbuf());
@@ -99,7 +114,43 @@ void TestBatch() {
   }
 }
 
+/**
+ * Running many tests on every core.
+ * You need to input rows, columns, mine_count, random seed, min_dist (as for TestBatch()) and the number of games.
+ *
+ * The maps are generated up front from the seed in the same order TestBatch() would use, then every game is played by
+ * a GameSession on a work-stealing pool, so the output does not depend on the number of threads. Unlike
+ * TestBatch(), no change to the server is needed.
+ */
+void TestBatchParallel() {
+  int rows, columns, mine_count, min_dist, games;
+  uint64_t seed;
+  std::cin >> rows >> columns >> mine_count >> seed >> min_dist >> games;
+  InitSeed(seed);
+  std::vector<GeneratedMap> maps(games);
+  for (int i = 0; i < games; ++i) {
+    maps[i] = GenerateMapData(rows, columns, mine_count, min_dist);
+  }
+  std::vector<GameResult> results(games);
+  const int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  // Frontier components recur from game to game, so the whole batch shares one cache of solved ones
+  ClientOptions options;
+  options.shared_component_cache = std::make_shared<ComponentCache>();
+  // Every worker plays all its games with one session, so the board and solver storage of a game is reused by the next
+  std::vector<std::unique_ptr<GameSession<>>> sessions(threads);
+  ParallelForWithWorker(games, threads, [&](int i, int worker) {
+    if (sessions[worker] == nullptr) sessions[worker] = std::make_unique<GameSession<>>(options);
+    results[i] = sessions[worker]->Play(maps[i]);
+  });
+  for (const GameResult &result : results) {
+    std::cout << (result.game_state == 1 ? "YOU WIN!" : "GAME OVER!") << std::endl;
+    std::cout << result.visit_count << " " << result.marked_mine_count << std::endl;
+  }
+  ProfileReport();
+}
+
 int main() {
   TestSingle();
   // TestBatch();
+  // TestBatchParallel();
 }
@@ -1,24 +1,65 @@
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 #include "server.h"
+#include "trace.h"
+
+// Binary trace of the game, written when the server runs with --trace <file>. It has static storage so that its
+// destructor completes the file when ExitGame() calls exit().
+static TraceWriter trace;
 
 /**
- * This is the main function of the game. You don't need to modify it.
- * Just finish server.h and run!
+ * Apply one operation: 0 for VisitBlock(x, y), 1 for MarkMine(x, y) and 2 for AutoExplore(x, y).
  */
-int main() {
+static void ApplyOperation(int pos_x, int pos_y, int type) {
+  if (type == 0) {
+    VisitBlock(pos_x, pos_y);
+  } else if (type == 1) {
+    MarkMine(pos_x, pos_y);
+  } else if (type == 2) {
+    AutoExplore(pos_x, pos_y);
+  }
+  trace.Record(pos_x, pos_y, type, game_state);
+}
+
+/**
+ * The server driver: read the map, then apply operations from stdin and print the map after each command until the
+ * game ends.
+ *
+ * Besides the stock command "x y type", it accepts the batch command "B N x1 y1 type1 ... xN yN typeN", which applies N
+ * operations and prints the map once; operations after one that ends the game are read but not applied. multi_server
+ * accepts the same form. Run as `server --trace <file>` to also record the game as a binary trace for the replay tool
+ * (see trace.h).
+ *
+ * The judge builds server.h against its own stock copy of this file, which knows neither extension, so server.h must
+ * not depend on them.
+ */
+int main(int argc, char **argv) {
   InitMap();
+  if (argc == 3 && std::strcmp(argv[1], "--trace") == 0) {
+    std::vector<uint64_t> mines(CorpusMineWords(rows, columns));
+    default_server.PackMines(mines.data());
+    if (!trace.Open(argv[2], rows, columns, mines.data())) std::cerr << "Cannot write trace " << argv[2] << std::endl;
+  }
   PrintMap();
   while (true) {
     int pos_x, pos_y, type;
     // Read the coordinate and operation type. 0 for VisitBlock(x, y), 1 for MarkMine(x, y) and 2 for AutoExplore(x, y)
-    std::cin >> pos_x >> pos_y >> type;
-    if (type == 0) {
-      VisitBlock(pos_x, pos_y);
-    } else if (type == 1) {
-      MarkMine(pos_x, pos_y);
-    } else if (type == 2) {
-      AutoExplore(pos_x, pos_y);
+    std::cin >> std::ws;
+    if (std::cin.peek() == 'B') {
+      // Batch command "B N x1 y1 type1 ... xN yN typeN": the N operations are applied in order and the map is printed
+      // once, after all of them. Operations after one that ends the game are read but not applied.
+      char marker;
+      int count;
+      std::cin >> marker >> count;
+      for (; count > 0; --count) {
+        std::cin >> pos_x >> pos_y >> type;
+        if (game_state == 0) ApplyOperation(pos_x, pos_y, type);
+      }
+    } else {
+      std::cin >> pos_x >> pos_y >> type;
+      ApplyOperation(pos_x, pos_y, type);
     }
     PrintMap();
     if (game_state != 0) {
@@ -0,0 +1,307 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "component_cache.h"
+#include "game_client.h"
+#include "generator.h"
+#include "profile.h"
+#include "scheduler.h"
+#include "server.h"
+#include "session.h"
+
+/**
+ * Headless strategy benchmark.
+ *
+ * Plays a seeded sweep of board sizes, mine densities and min_dist values with every registered strategy and prints
+ * one JSON document with, per configuration and strategy: win rate, mean score (as graded on OJ), guesses per game,
+ * games per second, heap allocations per game and the mean / p50 / p99 latency of a single Decide() call. Allocations
+ * made while adding to a ComponentCache are reported apart from the others: they grow storage shared with later games
+ * rather than the game's own.
+ *
+ * Before the measured games of a configuration, every worker's player plays W warm-up games of it, so that the
+ * allocation figures are those of a warm player. A warm player allocates only when a game needs more scratch storage
+ * than any game before it: more constraints than the linear engine held so far, a longer list of constraints per
+ * variable or per group, a larger frontier component to enumerate or key for the cache, a wider mine-count
+ * convolution, or more constraints and candidates in a sampled guess. "allocating_games" counts the measured games
+ * that allocated at all.
+ *
+ * Usage: bench [--games N] [--warmup W] [--seed S] [--threads T] [--strategies name,name,...] [--component-cache MODE]
+ *
+ * MODE is "shared" (default: one ComponentCache for every game of every strategy), "private" (a cache per worker
+ * thread and strategy, kept across its games) or "off". With a shared cache the document ends with its hit rate and
+ * memory use.
+ */
+
+// Heap allocations made by the calling thread, counted by the replacements of operator new below; those made inside
+// ComponentCache::Insert() are counted in cache_allocation_count instead
+thread_local uint64_t allocation_count = 0;
+thread_local uint64_t cache_allocation_count = 0;
+
+void *operator new(std::size_t size) {
+  ++(ComponentCache::Inserting() ? cache_allocation_count : allocation_count);
+  if (void *memory = std::malloc(size == 0 ? 1 : size)) return memory;
+  throw std::bad_alloc();
+}
+void *operator new[](std::size_t size) { return operator new(size); }
+// These do pair with the operator new above, but once GCC inlines one into a caller it sees std::free() release memory
+// from an operator new call and reports -Wmismatched-new-delete, so that warning is off for these definitions only.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept { std::free(memory); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+/**
+ * The "Rubbish" baseline: visit a uniformly random unknown cell every time.
+ */
+class RandomPlayer {
+ public:
+  explicit RandomPlayer(GameClient::Executor execute) : execute_(std::move(execute)) {}
+
+  void InitGame(int rows, int columns, int, int first_row, int first_column) {
+    rows_ = rows;
+    columns_ = columns;
+    guess_count_ = 0;
+    observed_map_.assign(static_cast<size_t>(rows) * columns, '?');
+    rng_.seed(static_cast<uint64_t>(first_row) * 1000003u + first_column);
+    execute_(first_row, first_column, 0);
+  }
+
+  void ReadMapView(const char *frame) {
+    for (int r = 0; r < rows_; ++r) {
+      const char *line = frame + static_cast<size_t>(r) * (columns_ + 1);
+      std::copy(line, line + columns_, observed_map_.begin() + static_cast<size_t>(r) * columns_);
+    }
+  }
+
+  void Decide() {
+    unknown_.clear();
+    for (int i = 0; i < rows_ * columns_; ++i) {
+      if (observed_map_[i] == '?') unknown_.push_back(i);
+    }
+    const int pick = unknown_[std::uniform_int_distribution<int>(0, static_cast<int>(unknown_.size()) - 1)(rng_)];
+    ++guess_count_;
+    execute_(pick / columns_, pick % columns_, 0);
+  }
+
+  int guess_count() const { return guess_count_; }
+
+ private:
+  GameClient::Executor execute_;
+  int rows_ = 0;
+  int columns_ = 0;
+  int guess_count_ = 0;
+  std::string observed_map_;
+  std::vector<int> unknown_;  // scratch of Decide(), kept to reuse its storage
+  std::mt19937_64 rng_;
+};
+
+/**
+ * A named way to play games. Any class with the Player interface of GameSession can be registered. Every worker thread
+ * makes its own player once and plays all its games with it, so the server and player storage of one game is reused
+ * by the next.
+ */
+using PlayFunction = std::function<GameResult(const GeneratedMap &, std::vector<uint32_t> *)>;
+
+struct Strategy {
+  std::string name;
+  std::function<PlayFunction()> make_player;
+};
+
+template <typename Player, typename... PlayerArgs>
+Strategy MakeStrategy(std::string name, PlayerArgs... player_args) {
+  return {std::move(name), [=] {
+            auto session = std::make_shared<GameSession<Player>>(player_args...);
+            return PlayFunction([session](const GeneratedMap &map, std::vector<uint32_t> *latencies) {
+              return session->Play(map, latencies);
+            });
+          }};
+}
+
+std::vector<Strategy> AllStrategies(const ClientOptions &full) {
+  ClientOptions single_cell = full;
+  single_cell.pattern_table = false;
+  single_cell.constraint_engine = false;
+  single_cell.exact_probabilities = false;
+  single_cell.contradiction_probing = false;
+  single_cell.monte_carlo = false;
+  ClientOptions no_enumeration = full;
+  no_enumeration.exact_probabilities = false;
+  no_enumeration.monte_carlo = false;
+  return {
+      MakeStrategy<GameClient>("full", full),
+      MakeStrategy<GameClient>("deduction", no_enumeration),
+      MakeStrategy<GameClient>("single_cell", single_cell),
+      MakeStrategy<RandomPlayer>("random"),
+  };
+}
+
+struct BoardConfig {
+  int rows;
+  int columns;
+  double density;
+  int min_dist;
+};
+
+double Percentile(const std::vector<uint32_t> &sorted, double fraction) {
+  if (sorted.empty()) return 0.0;
+  return sorted[std::min(sorted.size() - 1, static_cast<size_t>(fraction * sorted.size()))];
+}
+
+int main(int argc, char **argv) {
+  int games = 50;
+  int warmup = 20;
+  uint64_t seed = 20251021;
+  int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  std::string selected;
+  std::string cache_mode = "shared";
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const std::string flag = argv[i];
+    if (flag == "--games") {
+      games = std::atoi(argv[i + 1]);
+    } else if (flag == "--warmup") {
+      warmup = std::atoi(argv[i + 1]);
+    } else if (flag == "--seed") {
+      seed = std::strtoull(argv[i + 1], nullptr, 10);
+    } else if (flag == "--threads") {
+      threads = std::atoi(argv[i + 1]);
+    } else if (flag == "--strategies") {
+      selected = "," + std::string(argv[i + 1]) + ",";
+    } else if (flag == "--component-cache") {
+      cache_mode = argv[i + 1];
+    } else {
+      std::cerr << "Unknown flag " << flag << std::endl;
+      return 1;
+    }
+  }
+  ClientOptions full;
+  // A fixed number of samples per sampled guess, rather than a time budget, so that results repeat from run to run
+  full.sampler.chains = 8;
+  full.sampler.samples_per_chain = 64;
+  full.sampler.time_budget_ms = 0;
+  if (cache_mode == "shared") {
+    full.shared_component_cache = std::make_shared<ComponentCache>();
+  } else if (cache_mode == "off") {
+    full.component_cache = false;
+  } else if (cache_mode != "private") {
+    std::cerr << "Unknown component cache mode " << cache_mode << std::endl;
+    return 1;
+  }
+  std::vector<Strategy> strategies;
+  for (Strategy &strategy : AllStrategies(full)) {
+    if (selected.empty() || selected.find("," + strategy.name + ",") != std::string::npos) {
+      strategies.push_back(std::move(strategy));
+    }
+  }
+
+  std::vector<std::vector<PlayFunction>> players(strategies.size(), std::vector<PlayFunction>(threads));
+
+  const std::vector<std::pair<int, int>> sizes = {{9, 9}, {16, 16}, {16, 30}, {30, 30}};
+  const std::vector<double> densities = {0.12, 0.16, 0.21};
+  const std::vector<int> min_dists = {1, 2};
+
+  std::cout << "{\n  \"games_per_config\": " << games << ",\n  \"warmup_games_per_worker\": " << warmup
+            << ",\n  \"seed\": " << seed << ",\n  \"threads\": " << threads
+            << ",\n  \"results\": [";
+  bool first_entry = true;
+  for (auto [rows, columns] : sizes) {
+    for (double density : densities) {
+      for (int min_dist : min_dists) {
+        const int mine_count = static_cast<int>(rows * columns * density + 0.5);
+        InitSeed(seed);
+        std::vector<GeneratedMap> maps(games);
+        for (int i = 0; i < games; ++i) maps[i] = GenerateMapData(rows, columns, mine_count, min_dist);
+        // Drawn after the measured maps, so that those do not depend on the warm-up length
+        std::vector<GeneratedMap> warmup_maps(static_cast<size_t>(warmup) * threads);
+        for (GeneratedMap &map : warmup_maps) map = GenerateMapData(rows, columns, mine_count, min_dist);
+
+        for (const Strategy &strategy : strategies) {
+          std::vector<GameResult> results(games);
+          std::vector<std::vector<uint32_t>> latencies(games);
+          std::vector<uint64_t> allocations(games), cache_allocations(games);
+          std::vector<PlayFunction> &workers = players[&strategy - strategies.data()];
+          for (int worker = 0; worker < threads; ++worker) {
+            if (!workers[worker]) workers[worker] = strategy.make_player();
+            for (int i = 0; i < warmup; ++i) {
+              workers[worker](warmup_maps[static_cast<size_t>(worker) * warmup + i], nullptr);
+            }
+          }
+          const auto start = std::chrono::steady_clock::now();
+          ParallelForWithWorker(games, threads, [&](int i, int worker) {
+            if (!workers[worker]) workers[worker] = strategy.make_player();
+            latencies[i].reserve(2 * static_cast<size_t>(rows) * columns);  // not counted against the game
+            const uint64_t allocations_before = allocation_count;
+            const uint64_t cache_allocations_before = cache_allocation_count;
+            results[i] = workers[worker](maps[i], &latencies[i]);
+            allocations[i] = allocation_count - allocations_before;
+            cache_allocations[i] = cache_allocation_count - cache_allocations_before;
+          });
+          const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+          int wins = 0;
+          double score = 0.0, guesses = 0.0;
+          for (const GameResult &result : results) {
+            wins += result.game_state == 1;
+            score += static_cast<double>(result.visit_count + result.marked_mine_count) / (rows * columns);
+            guesses += result.guesses;
+          }
+          std::vector<uint32_t> all_latencies;
+          for (const auto &game_latencies : latencies) {
+            all_latencies.insert(all_latencies.end(), game_latencies.begin(), game_latencies.end());
+          }
+          std::sort(all_latencies.begin(), all_latencies.end());
+          double mean_allocations = 0.0, mean_cache_allocations = 0.0;
+          int allocating_games = 0;
+          for (uint64_t count : allocations) {
+            mean_allocations += static_cast<double>(count) / games;
+            allocating_games += count != 0;
+          }
+          for (uint64_t count : cache_allocations) mean_cache_allocations += static_cast<double>(count) / games;
+          double mean_latency = 0.0;
+          for (uint32_t latency : all_latencies) mean_latency += latency;
+          if (!all_latencies.empty()) mean_latency /= all_latencies.size();
+
+          std::cout << (first_entry ? "\n" : ",\n") << "    {\"strategy\": \"" << strategy.name << "\""
+                    << ", \"rows\": " << rows << ", \"columns\": " << columns << ", \"mines\": " << mine_count
+                    << ", \"min_dist\": " << min_dist
+                    << ", \"win_rate\": " << static_cast<double>(wins) / games << ", \"score\": " << score / games
+                    << ", \"guesses_per_game\": " << guesses / games << ", \"games_per_second\": " << games / seconds
+                    << ", \"allocations_per_game\": " << mean_allocations
+                    << ", \"allocating_games\": " << allocating_games
+                    << ", \"cache_allocations_per_game\": " << mean_cache_allocations
+                    << ", \"decision_latency_ns\": {\"mean\": " << mean_latency
+                    << ", \"p50\": " << Percentile(all_latencies, 0.50)
+                    << ", \"p99\": " << Percentile(all_latencies, 0.99) << "}}";
+          first_entry = false;
+        }
+      }
+    }
+  }
+  std::cout << "\n  ]";
+  if (const ComponentCache *cache = full.shared_component_cache.get()) {
+    const uint64_t lookups = cache->hits() + cache->misses();
+    std::cout << ",\n  \"component_cache\": {\"hits\": " << cache->hits() << ", \"misses\": " << cache->misses()
+              << ", \"hit_rate\": " << (lookups > 0 ? static_cast<double>(cache->hits()) / lookups : 0.0)
+              << ", \"evictions\": " << cache->evictions() << ", \"entries\": " << cache->entries()
+              << ", \"bytes\": " << cache->bytes() << ", \"max_bytes\": " << cache->max_bytes() << "}";
+  }
+  std::cout << "\n}" << std::endl;
+  ProfileReport();
+  return 0;
+}
@@ -0,0 +1,111 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "corpus.h"
+#include "generator.h"
+#include "profile.h"
+#include "server.h"
+#include "session.h"
+
+/**
+ * Binary map corpus tool.
+ *
+ *   corpus write <file> <rows> <columns> <mine_count> <seed> <min_dist> <maps>
+ *       Generate maps exactly as TestBatch() would and dump them into a corpus file.
+ *   corpus replay <file>
+ *       Play every map of the corpus with the full client and print the ExitGame()-style totals.
+ *   corpus scan <file>
+ *       Only stream every map into a server, to measure the loader on its own.
+ */
+
+namespace {
+
+int Usage() {
+  std::cerr << "usage: corpus write <file> <rows> <columns> <mine_count> <seed> <min_dist> <maps>\n"
+               "       corpus replay <file>\n"
+               "       corpus scan <file>\n";
+  return 2;
+}
+
+double SecondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int Write(int argc, char **argv) {
+  if (argc != 9) return Usage();
+  const int rows = std::atoi(argv[3]), columns = std::atoi(argv[4]), mine_count = std::atoi(argv[5]);
+  const uint64_t seed = std::strtoull(argv[6], nullptr, 10);
+  const int min_dist = std::atoi(argv[7]), maps = std::atoi(argv[8]);
+  CorpusWriter writer;
+  if (!writer.Open(argv[2])) {
+    std::cerr << "cannot write " << argv[2] << '\n';
+    return 1;
+  }
+  InitSeed(seed);
+  for (int i = 0; i < maps; ++i) {
+    writer.Write(GenerateMapData(rows, columns, mine_count, min_dist));
+  }
+  if (!writer.Close()) {
+    std::cerr << "cannot write " << argv[2] << '\n';
+    return 1;
+  }
+  return 0;
+}
+
+bool OpenCorpus(CorpusReader &reader, const char *path) {
+  if (reader.Open(path)) return true;
+  std::cerr << path << " is not a readable corpus\n";
+  return false;
+}
+
+int Replay(int argc, char **argv) {
+  if (argc != 3) return Usage();
+  CorpusReader reader;
+  if (!OpenCorpus(reader, argv[2])) return 1;
+  const auto start = std::chrono::steady_clock::now();
+  GameSession<> session;
+  CorpusMapView map;
+  uint64_t games = 0, wins = 0, visits = 0, marked = 0;
+  while (reader.Next(map)) {
+    const GameResult result = session.Play(map);
+    ++games;
+    wins += result.game_state == 1;
+    visits += result.visit_count;
+    marked += result.marked_mine_count;
+  }
+  std::cout << "games " << games << " wins " << wins << " visits " << visits << " marked " << marked << " seconds "
+            << SecondsSince(start) << std::endl;
+  ProfileReport();
+  return 0;
+}
+
+int Scan(int argc, char **argv) {
+  if (argc != 3) return Usage();
+  CorpusReader reader;
+  if (!OpenCorpus(reader, argv[2])) return 1;
+  const auto start = std::chrono::steady_clock::now();
+  GameServer server;
+  CorpusMapView map;
+  uint64_t maps = 0, mines = 0;
+  while (reader.Next(map)) {
+    server.InitMapPacked(map.rows, map.columns, map.mines);
+    ++maps;
+    mines += server.total_mines();
+  }
+  std::cout << "maps " << maps << " mines " << mines << " seconds " << SecondsSince(start) << std::endl;
+  return 0;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 3) return Usage();
+  const std::string command = argv[1];
+  if (command == "write") return Write(argc, argv);
+  if (command == "replay") return Replay(argc, argv);
+  if (command == "scan") return Scan(argc, argv);
+  return Usage();
+}
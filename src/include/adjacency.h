@@ -0,0 +1,112 @@
+/**
+ * Adjacent-mine counting as a 3x3 box sum over byte rows.
+ *
+ * The mines are laid out as bytes (0 or 1) in a plane padded with one zero cell on every side. For each board row, a
+ * kernel reads the padded rows above, at and below it and writes
+ *     counts[j] = sum of the 3x3 box around column j, minus the cell itself
+ * for every column, together with a bitmask of the columns that are not mines and have a count of zero. Counts never
+ * exceed 8, so the sums fit in bytes and a vector register handles 16 (SSE2) or 32 (AVX2) columns per step.
+ *
+ * AdjacencyRowKernel() picks the widest kernel the running CPU supports, with a scalar fallback for other targets.
+ */
+#ifndef ADJACENCY_H
+#define ADJACENCY_H
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ADJACENCY_X86 1
+#endif
+
+/**
+ * Count one row. `above`, `row` and `below` point at the padding cell left of column 0 of their padded rows, which
+ * hold width + 2 bytes; the vector kernels never read past them. `zero_bits` receives (width + 63) / 64 words, bit j
+ * standing for column j.
+ */
+using AdjacencyRowFunction = void (*)(const uint8_t *above, const uint8_t *row, const uint8_t *below, int width,
+                                      uint8_t *counts, uint64_t *zero_bits);
+
+namespace adjacency_detail {
+
+// Columns [from, width) one by one; the vector kernels finish their rows with it
+inline void CountColumns(const uint8_t *above, const uint8_t *row, const uint8_t *below, int from, int width,
+                         uint8_t *counts, uint64_t *zero_bits) {
+  for (int j = from; j < width; ++j) {
+    const uint8_t count = static_cast<uint8_t>(above[j] + above[j + 1] + above[j + 2] + row[j] + row[j + 2] +
+                                               below[j] + below[j + 1] + below[j + 2]);
+    counts[j] = count;
+    if (count == 0 && row[j + 1] == 0) zero_bits[j / 64] |= uint64_t{1} << (j % 64);
+  }
+}
+
+inline void ClearZeroBits(int width, uint64_t *zero_bits) {
+  for (int w = 0; w < (width + 63) / 64; ++w) zero_bits[w] = 0;
+}
+
+inline void CountRowScalar(const uint8_t *above, const uint8_t *row, const uint8_t *below, int width, uint8_t *counts,
+                           uint64_t *zero_bits) {
+  ClearZeroBits(width, zero_bits);
+  CountColumns(above, row, below, 0, width, counts, zero_bits);
+}
+
+#ifdef ADJACENCY_X86
+inline void CountRowSse2(const uint8_t *above, const uint8_t *row, const uint8_t *below, int width, uint8_t *counts,
+                         uint64_t *zero_bits) {
+  ClearZeroBits(width, zero_bits);
+  auto load = [](const uint8_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); };
+  const __m128i zero = _mm_setzero_si128();
+  int j = 0;
+  for (; j + 16 <= width; j += 16) {
+    const __m128i sides = _mm_add_epi8(load(row + j), load(row + j + 2));
+    const __m128i top = _mm_add_epi8(_mm_add_epi8(load(above + j), load(above + j + 1)), load(above + j + 2));
+    const __m128i bottom = _mm_add_epi8(_mm_add_epi8(load(below + j), load(below + j + 1)), load(below + j + 2));
+    const __m128i count = _mm_add_epi8(_mm_add_epi8(top, bottom), sides);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(counts + j), count);
+    const __m128i empty = _mm_cmpeq_epi8(_mm_or_si128(count, load(row + j + 1)), zero);
+    zero_bits[j / 64] |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(empty))) << (j % 64);
+  }
+  CountColumns(above, row, below, j, width, counts, zero_bits);
+}
+
+__attribute__((target("avx2"))) inline __m256i Load256(const uint8_t *p) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+}
+
+__attribute__((target("avx2"))) inline void CountRowAvx2(const uint8_t *above, const uint8_t *row,
+                                                         const uint8_t *below, int width, uint8_t *counts,
+                                                         uint64_t *zero_bits) {
+  ClearZeroBits(width, zero_bits);
+  const __m256i zero = _mm256_setzero_si256();
+  int j = 0;
+  for (; j + 32 <= width; j += 32) {
+    const __m256i sides = _mm256_add_epi8(Load256(row + j), Load256(row + j + 2));
+    const __m256i top =
+        _mm256_add_epi8(_mm256_add_epi8(Load256(above + j), Load256(above + j + 1)), Load256(above + j + 2));
+    const __m256i bottom =
+        _mm256_add_epi8(_mm256_add_epi8(Load256(below + j), Load256(below + j + 1)), Load256(below + j + 2));
+    const __m256i count = _mm256_add_epi8(_mm256_add_epi8(top, bottom), sides);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(counts + j), count);
+    const __m256i empty = _mm256_cmpeq_epi8(_mm256_or_si256(count, Load256(row + j + 1)), zero);
+    zero_bits[j / 64] |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(empty))) << (j % 64);
+  }
+  CountColumns(above, row, below, j, width, counts, zero_bits);
+}
+#endif
+
+}  // namespace adjacency_detail
+
+/**
+ * The fastest row kernel for this CPU, chosen once on first use.
+ */
+inline AdjacencyRowFunction AdjacencyRowKernel() {
+#ifdef ADJACENCY_X86
+  static const AdjacencyRowFunction kernel =
+      __builtin_cpu_supports("avx2") ? adjacency_detail::CountRowAvx2 : adjacency_detail::CountRowSse2;
+  return kernel;
+#else
+  return adjacency_detail::CountRowScalar;
+#endif
+}
+
+#endif
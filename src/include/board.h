@@ -0,0 +1,85 @@
+/**
+ * Board geometry known at compile time.
+ *
+ * Board<R, C> describes an R x C board with constexpr dimensions, bitboard row width and neighbour offset tables. Its
+ * ForEachNeighbor() is unrolled over the eight offsets, and its bounds checks compare against constants, so inside a
+ * kernel instantiated for a fixed size the compiler folds them away for interior cells and can unroll whole-board
+ * loops. For the common grading sizes a bitboard row is a single word, so per-row word loops disappear entirely.
+ * RuntimeBoard has the same interface for any other size.
+ *
+ * WithBoard() picks the instantiation for the common grading sizes and falls back to RuntimeBoard:
+ *
+ *   WithBoard(rows, columns, [&](const auto &board) { ... board.ForEachNeighbor(r, c, visit) ... });
+ */
+#ifndef BOARD_H
+#define BOARD_H
+
+#include <utility>
+
+constexpr int kNeighborRowOffsets[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+constexpr int kNeighborColumnOffsets[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+constexpr int kBoardWordBits = 64;  // columns per bitboard word
+
+namespace board_detail {
+
+template <typename Geometry, typename Visitor, size_t... K>
+inline void UnrolledNeighbors(const Geometry &board, int r, int c, Visitor &visit, std::index_sequence<K...>) {
+  auto one = [&](int nr, int nc) {
+    if (board.InBounds(nr, nc)) visit(nr, nc);
+  };
+  (one(r + kNeighborRowOffsets[K], c + kNeighborColumnOffsets[K]), ...);
+}
+
+}  // namespace board_detail
+
+template <int R, int C>
+struct Board {
+  static constexpr int kRows = R;
+  static constexpr int kColumns = C;
+  static constexpr int kWordsPerRow = (C + kBoardWordBits - 1) / kBoardWordBits;
+
+  constexpr int rows() const { return R; }
+  constexpr int columns() const { return C; }
+  constexpr int words_per_row() const { return kWordsPerRow; }
+  constexpr bool InBounds(int r, int c) const {
+    return static_cast<unsigned>(r) < static_cast<unsigned>(R) && static_cast<unsigned>(c) < static_cast<unsigned>(C);
+  }
+
+  template <typename Visitor>
+  void ForEachNeighbor(int r, int c, Visitor &&visit) const {
+    board_detail::UnrolledNeighbors(*this, r, c, visit, std::make_index_sequence<8>());
+  }
+};
+
+struct RuntimeBoard {
+  int rows_;
+  int columns_;
+
+  int rows() const { return rows_; }
+  int columns() const { return columns_; }
+  int words_per_row() const { return (columns_ + kBoardWordBits - 1) / kBoardWordBits; }
+  bool InBounds(int r, int c) const {
+    return static_cast<unsigned>(r) < static_cast<unsigned>(rows_) &&
+           static_cast<unsigned>(c) < static_cast<unsigned>(columns_);
+  }
+
+  template <typename Visitor>
+  void ForEachNeighbor(int r, int c, Visitor &&visit) const {
+    board_detail::UnrolledNeighbors(*this, r, c, visit, std::make_index_sequence<8>());
+  }
+};
+
+/**
+ * Call kernel(board) with the Board<R, C> matching rows x columns if it is one of the common sizes, or with a
+ * RuntimeBoard otherwise.
+ */
+template <typename Kernel>
+inline decltype(auto) WithBoard(int rows, int columns, Kernel &&kernel) {
+  if (rows == 9 && columns == 9) return kernel(Board<9, 9>());
+  if (rows == 16 && columns == 16) return kernel(Board<16, 16>());
+  if (rows == 16 && columns == 30) return kernel(Board<16, 30>());
+  if (rows == 30 && columns == 30) return kernel(Board<30, 30>());
+  return kernel(RuntimeBoard{rows, columns});
+}
+
+#endif
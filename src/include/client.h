@@ -1,10 +1,13 @@
+/**
+ * The global interface of the assignment (InitGame(), ReadMap(), ReadMapView() and Decide()) over one GameClient (see
+ * game_client.h). The driver must define Execute().
+ */
 #ifndef CLIENT_H
 #define CLIENT_H
 
 #include <iostream>
-#include <utility>
-#include <vector>
-#include <string>
+
+#include "game_client.h"
 
 extern int rows;         // The count of rows of the game map.
 extern int columns;      // The count of columns of the game map.
@@ -29,21 +32,19 @@ extern int total_mines;  // The count of mines of the game map.
  */
 void Execute(int r, int c, int type);
 
+// The game behind the global interface below
+static GameClient default_client([](int r, int c, int type) { Execute(r, c, type); });
+
 /**
  * @brief The definition of function InitGame()
  *
  * @details This function is designed to initialize the game. It should be called at the beginning of the game, which
  * will read the scale of the game map and the first step taken by the server (see README).
  */
-// Client-side observed map of the current game state
-static std::vector<std::string> observed_map;
-
 void InitGame() {
-  // Initialize all client-side global states
-  observed_map.assign(rows, std::string(columns, '?'));
   int first_row, first_column;
   std::cin >> first_row >> first_column;
-  Execute(first_row, first_column, 0);
+  default_client.InitGame(rows, columns, total_mines, first_row, first_column);
 }
 
 /**
@@ -56,18 +57,21 @@ void InitGame() {
  *     12?
  *     01?
  */
-// Client-side observed map of the current game state
 void ReadMap() {
-  observed_map.resize(rows);
-  for (int r = 0; r < rows; ++r) {
-    std::string line;
-    std::cin >> line;
-    // Defensive: ensure size matches columns
-    if (static_cast<int>(line.size()) < columns) {
-      line.resize(columns, '?');
-    }
-    observed_map[r] = line.substr(0, columns);
-  }
+  default_client.ReadMap(std::cin);
+}
+
+/**
+ * @brief The definition of function ReadMapView(const char *)
+ *
+ * @details This function is the in-process counterpart of ReadMap(). Instead of parsing the text printed by the server,
+ * it reads the board straight out of a rendered frame laid out exactly like the output of PrintMap(): rows lines of
+ * columns characters, each followed by '\n'.
+ *
+ * @param frame The first character of the rendered frame.
+ */
+void ReadMapView(const char *frame) {
+  default_client.ReadMapView(frame);
 }
 
 /**
@@ -76,131 +80,8 @@ void ReadMap() {
  * @details This function is designed to decide the next step when playing the client's (or player's) role. Open up your
  * mind and make your decision here! Caution: you can only execute once in this function.
  */
-static inline bool in_bounds(int r, int c) { return r >= 0 && r < rows && c >= 0 && c < columns; }
-
-static void neighbors(int r, int c, std::vector<std::pair<int, int>> &out) {
-  static const int dr[8] = {-1,-1,-1,0,0,1,1,1};
-  static const int dc[8] = {-1,0,1,-1,1,-1,0,1};
-  out.clear();
-  for (int k = 0; k < 8; ++k) {
-    int nr = r + dr[k], nc = c + dc[k];
-    if (in_bounds(nr, nc)) out.emplace_back(nr, nc);
-  }
-}
-
 void Decide() {
-  // Strategy: one action per Decide.
-  // Priority:
-  // 1) Mark obvious mines where (number - marked) == unknown
-  // 2) Auto-explore numbers where marked == number
-  // 3) Visit the unknown neighbor with minimum estimated risk among frontier cells
-
-  std::vector<std::pair<int, int>> nbrs;
-
-  // Step 1: try to mark an obvious mine
-  for (int r = 0; r < rows; ++r) {
-    for (int c = 0; c < columns; ++c) {
-      char ch = observed_map[r][c];
-      if (ch >= '0' && ch <= '8') {
-        int number_required = ch - '0';
-        neighbors(r, c, nbrs);
-        int marked_count = 0;
-        int unknown_count = 0;
-        for (auto [nr, nc] : nbrs) {
-          char v = observed_map[nr][nc];
-          if (v == '@') ++marked_count;
-          else if (v == '?') ++unknown_count;
-        }
-        if (unknown_count > 0 && (number_required - marked_count) == unknown_count) {
-          for (auto [nr, nc] : nbrs) {
-            if (observed_map[nr][nc] == '?') {
-              Execute(nr, nc, 1);
-              return;
-            }
-          }
-        }
-      }
-    }
-  }
-
-  // Step 2: try auto-explore on any satisfied number cell
-  for (int r = 0; r < rows; ++r) {
-    for (int c = 0; c < columns; ++c) {
-      char ch = observed_map[r][c];
-      if (ch >= '0' && ch <= '8') {
-        int number_required = ch - '0';
-        neighbors(r, c, nbrs);
-        int marked_count = 0;
-        int unknown_count = 0;
-        for (auto [nr, nc] : nbrs) {
-          char v = observed_map[nr][nc];
-          if (v == '@') ++marked_count;
-          else if (v == '?') ++unknown_count;
-        }
-        if (marked_count == number_required && unknown_count > 0) {
-          Execute(r, c, 2);  // auto-explore
-          return;
-        }
-      }
-    }
-  }
-
-  // Step 3: Visit the least risky frontier unknown based on simple probability estimate
-  double best_risk = 1e9;
-  int best_r = -1, best_c = -1;
-  for (int r = 0; r < rows; ++r) {
-    for (int c = 0; c < columns; ++c) {
-      if (observed_map[r][c] == '?') {
-        // compute risk from adjacent revealed numbers
-        neighbors(r, c, nbrs);
-        double cell_risk = 1.0; // default risk for isolated cells
-        bool has_context = false;
-        double worst_local = 0.0;
-        for (auto [nr, nc] : nbrs) {
-          char v = observed_map[nr][nc];
-          if (v >= '0' && v <= '8') {
-            has_context = true;
-            int number_required = v - '0';
-            // compute unknown and marked around that number
-            std::vector<std::pair<int,int>> nn;
-            neighbors(nr, nc, nn);
-            int marked_count = 0, unknown_count = 0;
-            for (auto [ar, ac] : nn) {
-              char vv = observed_map[ar][ac];
-              if (vv == '@') ++marked_count;
-              else if (vv == '?') ++unknown_count;
-            }
-            int remaining = number_required - marked_count;
-            if (remaining < 0) remaining = 0;
-            if (unknown_count > 0) {
-              double local = static_cast<double>(remaining) / static_cast<double>(unknown_count);
-              if (local > worst_local) worst_local = local; // pessimistic aggregation
-            }
-          }
-        }
-        if (has_context) cell_risk = worst_local; else cell_risk = 0.5; // arbitrary prior
-        if (cell_risk < best_risk) {
-          best_risk = cell_risk;
-          best_r = r;
-          best_c = c;
-        }
-      }
-    }
-  }
-  if (best_r != -1) {
-    Execute(best_r, best_c, 0);
-    return;
-  }
-
-  // Fallback: visit any unknown (should rarely happen)
-  for (int r = 0; r < rows; ++r) {
-    for (int c = 0; c < columns; ++c) {
-      if (observed_map[r][c] == '?') {
-        Execute(r, c, 0);
-        return;
-      }
-    }
-  }
+  default_client.Decide();
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,218 @@
+/**
+ * Solved frontier components, shared between moves and (optionally) between the games of a batch.
+ *
+ * What the client's enumeration counts about a component depends only on its constraints: which of its variables
+ * each one covers and how many mines it needs. CanonicalComponent() names the variables by rank in row-major order of
+ * their board positions, which is the same wherever the component sits, and takes the smallest description over the
+ * rotations and reflections of the board, so a component and its translated, rotated or mirrored copies share one
+ * key. A cached entry lists the counts with variables in that canonical order.
+ *
+ * ComponentCache is an LRU map from keys to entries, bounded by an estimate of the bytes it holds. It takes a mutex
+ * per lookup and per insertion, which is noise next to an enumeration, so one cache can serve every worker thread of a
+ * batch.
+ */
+#ifndef COMPONENT_CACHE_H
+#define COMPONENT_CACHE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "profile.h"
+
+constexpr size_t kDefaultComponentCacheBytes = size_t{32} << 20;
+
+struct SolvedComponent {
+  bool solved = false;            // false if the enumeration ran out of nodes, so that it is not tried again
+  std::vector<double> ways;       // ways[k]: consistent assignments with k mines
+  std::vector<double> cell_ways;  // cell_ways[k * size + i]: those of them where canonical variable i is a mine
+};
+
+// Storage of CanonicalComponent(), kept by the caller so that keying a component does not allocate once it is warm
+struct CanonicalScratch {
+  std::vector<std::pair<std::pair<int, int>, int>> placed, best_shape;  // (shifted position, variable), sorted
+  std::vector<int> ties, rank, candidate;
+  std::vector<std::vector<int>> rows;  // only the first constraint count are in use
+};
+
+/**
+ * The canonical key of a component. `positions` holds the board row and column of each variable, and `constraints`
+ * lists every constraint as the number of variables it covers, its mine count and those variables. Fills `order` with
+ * the variables in canonical order.
+ *
+ * Only the symmetries under which the variables' positions, shifted to the origin, read smallest are tried as keys: two
+ * copies of a component are related by a symmetry that maps one shape onto the other, so they reach the same smallest
+ * shape. Describing the constraints is the expensive part, and few shapes are symmetric.
+ */
+inline void CanonicalComponent(const std::vector<std::pair<int, int>> &positions, const std::vector<int> &constraints,
+                               std::vector<int> &key, std::vector<int> &order, CanonicalScratch &scratch) {
+  const int size = static_cast<int>(positions.size());
+  auto &placed = scratch.placed;
+  placed.resize(size);
+  auto place = [&](int t) {
+    int min_column = 0;
+    for (int v = 0; v < size; ++v) {
+      const int r = positions[v].first, c = positions[v].second;
+      const int rs[8] = {r, c, -r, -c, r, -r, c, -c};
+      const int cs[8] = {c, -r, -c, r, -c, c, r, -r};
+      placed[v] = {{rs[t], cs[t]}, v};
+      min_column = v == 0 ? cs[t] : std::min(min_column, cs[t]);
+    }
+    std::sort(placed.begin(), placed.end());
+    const std::pair<int, int> origin = {placed[0].first.first, min_column};
+    for (auto &cell : placed) cell.first = {cell.first.first - origin.first, cell.first.second - origin.second};
+  };
+
+  auto &best_shape = scratch.best_shape;
+  auto &ties = scratch.ties;
+  best_shape.clear();
+  ties.clear();
+  for (int t = 0; t < 8; ++t) {
+    place(t);
+    int compare = best_shape.empty() ? -1 : 0;
+    for (int i = 0; i < size && compare == 0; ++i) {
+      if (placed[i].first != best_shape[i].first) compare = placed[i].first < best_shape[i].first ? -1 : 1;
+    }
+    if (compare < 0) {
+      best_shape.assign(placed.begin(), placed.end());
+      ties.clear();
+    }
+    if (compare <= 0) ties.push_back(t);
+  }
+
+  auto &rank = scratch.rank;
+  auto &candidate = scratch.candidate;
+  auto &rows = scratch.rows;
+  rank.resize(size);
+  size_t count = 0;
+  for (size_t at = 0; at < constraints.size(); at += constraints[at] + 2) ++count;
+  if (rows.size() < count) rows.resize(count);
+  key.clear();
+  for (int t : ties) {
+    place(t);
+    for (int i = 0; i < size; ++i) rank[placed[i].second] = i;
+    size_t at = 0;
+    for (size_t k = 0; k < count; ++k) {
+      const int covered = constraints[at];
+      rows[k].assign(1, constraints[at + 1]);
+      for (int j = 0; j < covered; ++j) rows[k].push_back(rank[constraints[at + 2 + j]]);
+      std::sort(rows[k].begin() + 1, rows[k].end());
+      at += covered + 2;
+    }
+    std::sort(rows.begin(), rows.begin() + count);
+    candidate.assign(1, size);
+    for (size_t k = 0; k < count; ++k) {
+      candidate.push_back(static_cast<int>(rows[k].size()));
+      candidate.insert(candidate.end(), rows[k].begin(), rows[k].end());
+    }
+    if (key.empty() || candidate < key) {
+      key.swap(candidate);
+      order.resize(size);
+      for (int i = 0; i < size; ++i) order[i] = placed[i].second;
+    }
+  }
+}
+
+class ComponentCache {
+ public:
+  explicit ComponentCache(size_t max_bytes = kDefaultComponentCacheBytes) : max_bytes_(max_bytes) {}
+  ComponentCache(const ComponentCache &) = delete;
+  ComponentCache &operator=(const ComponentCache &) = delete;
+
+  /**
+   * Copy the entry of a key into `out` and make it the most recently used one. Returns false on a miss.
+   */
+  bool Find(const std::vector<int> &key, SolvedComponent &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto found = index_.find(key);
+    if (found == index_.end()) {
+      ++misses_;
+      PROFILE_COUNT(kCountComponentCacheMisses, 1);
+      return false;
+    }
+    ++hits_;
+    PROFILE_COUNT(kCountComponentCacheHits, 1);
+    entries_.splice(entries_.begin(), entries_, found->second);
+    out = found->second->value;
+    return true;
+  }
+
+  /**
+   * Add an entry, evicting the least recently used ones while the cache is over its budget.
+   */
+  void Insert(const std::vector<int> &key, const SolvedComponent &value) {
+    InsertScope scope;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (index_.count(key) != 0) return;  // another game solved it meanwhile
+    entries_.push_front({key, value, EntryBytes(key, value)});
+    index_.emplace(key, entries_.begin());
+    bytes_ += entries_.front().bytes;
+    while (bytes_ > max_bytes_ && !entries_.empty()) {
+      bytes_ -= entries_.back().bytes;
+      index_.erase(entries_.back().key);
+      entries_.pop_back();
+      ++evictions_;
+    }
+  }
+
+  /**
+   * Whether the calling thread is inside Insert(), so that an allocation counter (bench.cpp) can tell the heap blocks
+   * of a growing cache apart from those of the game that happened to add to it.
+   */
+  static bool Inserting() { return InsertingFlag(); }
+
+  // Statistics, to be read once no game is using the cache any more
+  uint64_t hits() const { return hits_; }
+  uint64_t misses() const { return misses_; }
+  uint64_t evictions() const { return evictions_; }
+  size_t entries() const { return index_.size(); }
+  size_t bytes() const { return bytes_; }
+  size_t max_bytes() const { return max_bytes_; }
+
+ private:
+  static bool &InsertingFlag() {
+    thread_local bool inserting = false;
+    return inserting;
+  }
+
+  struct InsertScope {
+    InsertScope() { InsertingFlag() = true; }
+    ~InsertScope() { InsertingFlag() = false; }
+  };
+
+  struct Entry {
+    std::vector<int> key;
+    SolvedComponent value;
+    size_t bytes;
+  };
+
+  struct KeyHash {
+    size_t operator()(const std::vector<int> &key) const {
+      uint64_t hash = 14695981039346656037ull;
+      for (int value : key) hash = (hash ^ static_cast<uint32_t>(value)) * 1099511628211ull;
+      return static_cast<size_t>(hash);
+    }
+  };
+
+  // The entry's own storage, its key a second time in the index, and list and hash nodes
+  static size_t EntryBytes(const std::vector<int> &key, const SolvedComponent &value) {
+    const size_t counts = value.ways.size() + value.cell_ways.size();
+    return sizeof(Entry) + 2 * key.size() * sizeof(int) + counts * sizeof(double) + sizeof(std::vector<int>) +
+           4 * sizeof(void *);
+  }
+
+  std::mutex mutex_;
+  std::list<Entry> entries_;  // most recently used first
+  std::unordered_map<std::vector<int>, std::list<Entry>::iterator, KeyHash> index_;
+  size_t max_bytes_;
+  size_t bytes_ = 0;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+  uint64_t evictions_ = 0;
+};
+
+#endif
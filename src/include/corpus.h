@@ -0,0 +1,204 @@
+/**
+ * A compact binary corpus of maps for regression runs, read back through mmap so that replaying it involves no text
+ * parsing at all.
+ *
+ * Layout (every record starts on an 8-byte boundary):
+ *   file header   magic "MSWC", uint32 version, uint32 byte-order mark, uint32 reserved (0), uint64 map count
+ *   per map       uint32 rows, uint32 columns, uint32 first_row, uint32 first_column,
+ *                 ceil(rows * columns / 64) uint64 words: the mine bitset in row-major order, cell (i, j) being
+ *                 bit (k % 64) of word (k / 64) with k = i * columns + j
+ *
+ * Integers are stored in the byte order of the machine that wrote the file, so that the reader can use the mapped
+ * words as they are. The byte-order mark (kCorpusByteOrderMark as written) tells a reader on a machine of the other
+ * order that the file is not for it; Open() refuses such files rather than converting them.
+ */
+#ifndef CORPUS_H
+#define CORPUS_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "generator.h"
+
+constexpr char kCorpusMagic[4] = {'M', 'S', 'W', 'C'};
+constexpr uint32_t kCorpusVersion = 2;
+constexpr uint32_t kCorpusByteOrderMark = 0x01020304;
+// Largest row or column count a record may have, as for the sessions of multi_server.h
+constexpr uint32_t kMaxCorpusBoardSide = 1024;
+
+struct CorpusFileHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t reserved;
+  uint64_t map_count;
+};
+
+struct CorpusMapHeader {
+  uint32_t rows;
+  uint32_t columns;
+  uint32_t first_row;
+  uint32_t first_column;
+};
+
+inline size_t CorpusMineWords(uint32_t rows, uint32_t columns) {
+  return (static_cast<size_t>(rows) * columns + 63) / 64;
+}
+
+/**
+ * One map of a corpus, pointing into the mapped file.
+ */
+struct CorpusMapView {
+  int rows = 0;
+  int columns = 0;
+  int first_row = 0;
+  int first_column = 0;
+  const uint64_t *mines = nullptr;  // packed row-major mine bitset, see the layout above
+};
+
+/**
+ * Appends maps to a corpus file. The map count in the file header is filled in by Close() (or the destructor).
+ */
+class CorpusWriter {
+ public:
+  ~CorpusWriter() { Close(); }
+
+  bool Open(const std::string &path) {
+    out_.open(path, std::ios::binary | std::ios::trunc);
+    map_count_ = 0;
+    WriteHeader();
+    return static_cast<bool>(out_);
+  }
+
+  void Write(const GeneratedMap &map) {
+    const CorpusMapHeader header{static_cast<uint32_t>(map.rows), static_cast<uint32_t>(map.columns),
+                                 static_cast<uint32_t>(map.first_row), static_cast<uint32_t>(map.first_column)};
+    out_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    words_.assign(CorpusMineWords(header.rows, header.columns), 0);
+    for (size_t k = 0; k < map.mines.size(); ++k) {
+      if (map.mines[k]) words_[k / 64] |= uint64_t{1} << (k % 64);
+    }
+    out_.write(reinterpret_cast<const char *>(words_.data()), static_cast<std::streamsize>(words_.size() * 8));
+    ++map_count_;
+  }
+
+  bool Close() {
+    if (!out_.is_open()) return true;
+    out_.seekp(0);
+    WriteHeader();
+    out_.close();
+    return !out_.fail();
+  }
+
+ private:
+  void WriteHeader() {
+    CorpusFileHeader header;
+    std::memcpy(header.magic, kCorpusMagic, sizeof(header.magic));
+    header.version = kCorpusVersion;
+    header.byte_order = kCorpusByteOrderMark;
+    header.reserved = 0;
+    header.map_count = map_count_;
+    out_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  }
+
+  std::ofstream out_;
+  uint64_t map_count_ = 0;
+  std::vector<uint64_t> words_;
+};
+
+/**
+ * Streams the maps of a corpus file straight out of a read-only memory mapping.
+ */
+class CorpusReader {
+ public:
+  CorpusReader() = default;
+  CorpusReader(const CorpusReader &) = delete;
+  CorpusReader &operator=(const CorpusReader &) = delete;
+  ~CorpusReader() { Close(); }
+
+  /**
+   * Map the file and check its header. Returns false (and stays closed) if the file is missing, not a corpus or written
+   * in the other byte order.
+   */
+  bool Open(const std::string &path) {
+    Close();
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(CorpusFileHeader)) {
+      close(fd);
+      return false;
+    }
+    size_ = static_cast<size_t>(info.st_size);
+    void *data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+    data_ = static_cast<const uint8_t *>(data);
+    madvise(data, size_, MADV_SEQUENTIAL);
+    const auto *header = reinterpret_cast<const CorpusFileHeader *>(data_);
+    if (std::memcmp(header->magic, kCorpusMagic, sizeof(header->magic)) != 0 || header->version != kCorpusVersion ||
+        header->byte_order != kCorpusByteOrderMark) {
+      Close();
+      return false;
+    }
+    map_count_ = header->map_count;
+    Rewind();
+    return true;
+  }
+
+  void Close() {
+    if (data_ != nullptr) munmap(const_cast<uint8_t *>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+    map_count_ = 0;
+  }
+
+  uint64_t map_count() const { return map_count_; }
+
+  void Rewind() {
+    offset_ = sizeof(CorpusFileHeader);
+    maps_read_ = 0;
+  }
+
+  /**
+   * Point `map` at the next map of the corpus. Returns false at the end of the corpus, on a truncated record or on a
+   * record whose board is empty, larger than kMaxCorpusBoardSide on a side or starts off the board.
+   */
+  bool Next(CorpusMapView &map) {
+    if (data_ == nullptr || maps_read_ == map_count_ || offset_ + sizeof(CorpusMapHeader) > size_) return false;
+    const auto *header = reinterpret_cast<const CorpusMapHeader *>(data_ + offset_);
+    if (header->rows < 1 || header->rows > kMaxCorpusBoardSide || header->columns < 1 ||
+        header->columns > kMaxCorpusBoardSide || header->first_row >= header->rows ||
+        header->first_column >= header->columns) {
+      return false;
+    }
+    const size_t words = CorpusMineWords(header->rows, header->columns);
+    const size_t record = sizeof(CorpusMapHeader) + words * 8;
+    if (offset_ + record > size_) return false;
+    map.rows = static_cast<int>(header->rows);
+    map.columns = static_cast<int>(header->columns);
+    map.first_row = static_cast<int>(header->first_row);
+    map.first_column = static_cast<int>(header->first_column);
+    map.mines = reinterpret_cast<const uint64_t *>(data_ + offset_ + sizeof(CorpusMapHeader));
+    offset_ += record;
+    ++maps_read_;
+    return true;
+  }
+
+ private:
+  const uint8_t *data_ = nullptr;
+  size_t size_ = 0;
+  size_t offset_ = 0;
+  uint64_t map_count_ = 0;
+  uint64_t maps_read_ = 0;
+};
+
+#endif
@@ -0,0 +1,1464 @@
+/**
+ * The player as a class, GameClient, with no global state. The tools that play games in process (the benchmark, the
+ * corpus recorder, the pattern generator) include this header alone; client.h adds the global interface of the
+ * assignment on top of it, which needs Execute() from the driver.
+ */
+#ifndef GAME_CLIENT_H
+#define GAME_CLIENT_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <string>
+
+#include "component_cache.h"
+#include "pattern.h"
+#include "profile.h"
+#include "sampler.h"
+
+static inline bool is_number(char ch) { return ch >= '0' && ch <= '8'; }
+
+// An action proven safe by an earlier analysis, waiting for its own Decide() call
+struct PlannedAction {
+  int cell;  // padded cell index (see GameClient)
+  int type;  // same as the type argument of Execute()
+};
+
+/**
+ * Copy-on-write forks of the client's knowledge: the observed map, the neighbour counters, the dirty worklist, the
+ * planned actions and the constraint system (frontier numbering and constraints). Instead of copying the state, a fork
+ * remembers how long the undo log, the dirty worklist and the plan were; every hypothetical cell edit made after it
+ * logs the character it overwrote, and rolling back replays the log backwards and drops whatever was queued or planned
+ * since. Forking is O(1) and rolling back is O(cells changed since the fork), and forks nest.
+ *
+ * The constraint system is derived from the map as a whole by collect_constraints(), so it is not logged cell by cell:
+ * if it was rebuilt inside the fork, rolling back rebuilds it once more from the restored map, which costs no more
+ * than the rebuild the fork made.
+ */
+struct KnowledgeEdit {
+  int cell;
+  char before;
+};
+
+struct KnowledgeFork {
+  size_t edits;                // undo log length at the fork
+  size_t dirty_cells;          // dirty worklist length at the fork
+  size_t planned_actions;      // planned action queue length at the fork
+  uint64_t constraint_builds;  // collect_constraints() calls before the fork
+};
+
+// A cell assumed safe while probing, whose number is not known
+constexpr char kAssumedSafe = '.';
+// Cells a single probe may settle before it gives up without a verdict
+constexpr int kMaxProbeSteps = 256;
+
+/*
+ * Linear constraint deduction.
+ * Each unknown cell next to a number becomes a frontier variable (one bit in a CellBits set), and each such number
+ * becomes a Constraint saying how many of its unknown neighbours are mines. Deductions come from
+ *   - trivial constraints, where the mines are 0 or equal to the number of cells;
+ *   - subset reduction: if A is a proper subset of B, then B \ A holds B.mines - A.mines mines;
+ *   - integer Gaussian elimination inside each connected group of constraints: a reduced row whose right-hand side
+ *     equals the smallest or the largest sum its 0/1 variables allow fixes every variable in it.
+ */
+using CellBits = std::vector<uint64_t>;
+
+struct Constraint {
+  CellBits cells;  // frontier variables covered
+  int mines;       // mines among them
+};
+
+static constexpr int kMaxDerivedConstraints = 4096;      // cap on constraints added by subset reduction
+static constexpr int64_t kMaxEliminationCoefficient = int64_t{1} << 40;  // give up on a group past this
+
+static inline int bits_count(const CellBits &a) {
+  int count = 0;
+  for (uint64_t w : a) count += __builtin_popcountll(w);
+  return count;
+}
+
+static inline bool bits_subset(const CellBits &a, const CellBits &b) {
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i] & ~b[i]) return false;
+  }
+  return true;
+}
+
+static inline void bits_set(CellBits &a, int i) { a[i / 64] |= uint64_t{1} << (i % 64); }
+
+template <typename Visitor>
+static inline void for_each_bit(const CellBits &a, Visitor &&visit) {
+  for (size_t w = 0; w < a.size(); ++w) {
+    for (uint64_t bits = a[w]; bits != 0; bits &= bits - 1) {
+      visit(static_cast<int>(w * 64 + __builtin_ctzll(bits)));
+    }
+  }
+}
+
+/**
+ * A set of bit sets of one length, stored one after another in a single array and found through an open-addressing
+ * table, so that clearing it keeps all of its storage.
+ */
+class CellBitsSet {
+ public:
+  void Clear(size_t words) {
+    words_ = words;
+    count_ = 0;
+    stored_.clear();
+    std::fill(slots_.begin(), slots_.end(), -1);
+  }
+
+  // Add a bit set of the length given to Clear(). Returns false if it was there already.
+  bool Insert(const CellBits &bits) {
+    if (2 * (count_ + 1) > slots_.size()) Grow();
+    const size_t mask = slots_.size() - 1;
+    for (size_t slot = Hash(bits.data()) & mask;; slot = (slot + 1) & mask) {
+      if (slots_[slot] == -1) {
+        slots_[slot] = static_cast<int>(count_++);
+        stored_.insert(stored_.end(), bits.begin(), bits.end());
+        return true;
+      }
+      if (std::equal(bits.begin(), bits.end(), stored_.begin() + slots_[slot] * words_)) return false;
+    }
+  }
+
+ private:
+  size_t Hash(const uint64_t *words) const {
+    uint64_t hash = 0x9e3779b97f4a7c15ull;
+    for (size_t w = 0; w < words_; ++w) hash = (hash ^ words[w]) * 0xbf58476d1ce4e5b9ull;
+    return static_cast<size_t>(hash ^ (hash >> 31));
+  }
+
+  void Grow() {
+    slots_.assign(std::max<size_t>(64, 2 * slots_.size()), -1);
+    const size_t mask = slots_.size() - 1;
+    for (size_t i = 0; i < count_; ++i) {
+      size_t slot = Hash(stored_.data() + i * words_) & mask;
+      while (slots_[slot] != -1) slot = (slot + 1) & mask;
+      slots_[slot] = static_cast<int>(i);
+    }
+  }
+
+  size_t words_ = 0;
+  size_t count_ = 0;
+  std::vector<uint64_t> stored_;  // the bit sets in insertion order
+  std::vector<int> slots_;        // index into the bit sets, -1 if free; a power of two, at most half full
+};
+
+// Storage of the linear engine, kept from one call to the next so that a warm client runs it without allocating
+struct DeductionScratch {
+  std::vector<CellBits> spare_bits;        // bit sets of dropped constraints, handed on to new ones
+  CellBitsSet seen;                        // constraints present so far, by the variables they cover
+  std::vector<signed char> value;          // frontier variable -> -1 unknown, 0 safe, 1 mine
+  std::vector<std::vector<int>> covering;  // variable -> constraints covering it
+  std::vector<int> checked_for;
+  CellBits subset, rest;
+  std::vector<int> columns_of, local, parent;
+  std::vector<int64_t> matrix;             // rows of width + 1 coefficients, one after another
+  std::vector<std::vector<int>> groups;    // root variable -> constraints of its group
+};
+
+/**
+ * Resize a list of constraints without freeing any bit set: the constraints cut off leave theirs in `spare`, and new
+ * constraints take theirs from there. The bit sets of new constraints hold stale words and have to be assigned.
+ */
+static void resize_constraints(std::vector<Constraint> &constraints, size_t size, std::vector<CellBits> &spare) {
+  for (; constraints.size() > size; constraints.pop_back()) spare.push_back(std::move(constraints.back().cells));
+  while (constraints.size() < size) {
+    constraints.push_back({{}, 0});
+    if (spare.empty()) continue;
+    constraints.back().cells.swap(spare.back());
+    spare.pop_back();
+  }
+}
+
+/**
+ * Empty the first `count` lists of `lists`, adding lists if there are fewer. Lists past `count` are left alone, so
+ * their storage survives for later calls.
+ */
+static void reset_lists(std::vector<std::vector<int>> &lists, size_t count) {
+  if (lists.size() < count) lists.resize(count);
+  for (size_t i = 0; i < count; ++i) lists[i].clear();
+}
+
+/**
+ * Add B \ A for every pair of constraints with A a proper subset of B. Returns whether anything new was added.
+ */
+static bool reduce_subsets(std::vector<Constraint> &constraints, DeductionScratch &scratch, int variables) {
+  std::vector<std::vector<int>> &covering = scratch.covering;
+  reset_lists(covering, variables);
+  for (int i = 0; i < static_cast<int>(constraints.size()); ++i) {
+    for_each_bit(constraints[i].cells, [&](int v) { covering[v].push_back(i); });
+  }
+  scratch.checked_for.assign(constraints.size(), -1);
+  const int original = static_cast<int>(constraints.size());
+  bool added = false;
+  for (int i = 0; i < original; ++i) {
+    // A copy, since constraints may reallocate while we append below
+    scratch.subset.assign(constraints[i].cells.begin(), constraints[i].cells.end());
+    const CellBits &cells_i = scratch.subset;
+    const int size_i = bits_count(cells_i);
+    for_each_bit(cells_i, [&](int v) {
+      for (int j : covering[v]) {
+        if (j == i || scratch.checked_for[j] == i) continue;
+        scratch.checked_for[j] = i;
+        if (static_cast<int>(constraints.size()) >= kMaxDerivedConstraints) return;
+        if (bits_count(constraints[j].cells) <= size_i) continue;
+        if (!bits_subset(cells_i, constraints[j].cells)) continue;
+        CellBits &rest = scratch.rest;
+        rest.assign(constraints[j].cells.begin(), constraints[j].cells.end());
+        for (size_t w = 0; w < rest.size(); ++w) rest[w] &= ~cells_i[w];
+        if (!scratch.seen.Insert(rest)) continue;
+        const int mines = constraints[j].mines - constraints[i].mines;
+        resize_constraints(constraints, constraints.size() + 1, scratch.spare_bits);
+        constraints.back().cells.assign(rest.begin(), rest.end());
+        constraints.back().mines = mines;
+        added = true;
+      }
+    });
+  }
+  return added;
+}
+
+/**
+ * Run fraction-free Gaussian elimination on one connected group of constraints and fix the variables of every row
+ * that sits at an extreme of its range.
+ */
+static bool eliminate_group(const std::vector<Constraint> &constraints, const std::vector<int> &group,
+                            std::vector<signed char> &value, DeductionScratch &scratch) {
+  std::vector<int> &columns_of = scratch.columns_of;  // local column -> variable
+  std::vector<int> &local = scratch.local;
+  columns_of.clear();
+  local.assign(value.size(), -1);
+  for (int i : group) {
+    for_each_bit(constraints[i].cells, [&](int v) {
+      if (local[v] == -1) {
+        local[v] = static_cast<int>(columns_of.size());
+        columns_of.push_back(v);
+      }
+    });
+  }
+  const int width = static_cast<int>(columns_of.size());
+  const int height = static_cast<int>(group.size());
+  std::vector<int64_t> &matrix = scratch.matrix;
+  matrix.assign(static_cast<size_t>(height) * (width + 1), 0);
+  auto row_of = [&](int k) { return matrix.data() + static_cast<size_t>(k) * (width + 1); };
+  for (int k = 0; k < height; ++k) {
+    int64_t *row = row_of(k);
+    for_each_bit(constraints[group[k]].cells, [&](int v) { row[local[v]] = 1; });
+    row[width] = constraints[group[k]].mines;
+  }
+  int rank = 0;
+  for (int col = 0; col < width && rank < height; ++col) {
+    int pivot = rank;
+    while (pivot < height && row_of(pivot)[col] == 0) ++pivot;
+    if (pivot == height) continue;
+    std::swap_ranges(row_of(rank), row_of(rank) + width + 1, row_of(pivot));
+    const int64_t *pivot_row = row_of(rank);
+    for (int k = 0; k < height; ++k) {
+      int64_t *row = row_of(k);
+      if (k == rank || row[col] == 0) continue;
+      const int64_t p = pivot_row[col], q = row[col];
+      int64_t divisor = 0;
+      for (int j = 0; j <= width; ++j) {
+        // Coefficients up to kMaxEliminationCoefficient can still multiply past 64 bits, so check before storing.
+        // INT64_MIN is refused too, as std::gcd() and std::llabs() cannot take it.
+        int64_t scaled, subtracted, result;
+        if (__builtin_mul_overflow(row[j], p, &scaled) || __builtin_mul_overflow(pivot_row[j], q, &subtracted) ||
+            __builtin_sub_overflow(scaled, subtracted, &result) || result == INT64_MIN) {
+          return false;
+        }
+        row[j] = result;
+        divisor = std::gcd(divisor, row[j]);
+      }
+      if (divisor > 1) {
+        for (int j = 0; j <= width; ++j) row[j] /= divisor;
+      }
+      for (int j = 0; j <= width; ++j) {
+        if (std::llabs(row[j]) > kMaxEliminationCoefficient) return false;
+      }
+    }
+    ++rank;
+  }
+  bool fixed = false;
+  for (int k = 0; k < height; ++k) {
+    const int64_t *row = row_of(k);
+    int64_t low = 0, high = 0;
+    for (int j = 0; j < width; ++j) {
+      if (row[j] < 0) low += row[j]; else high += row[j];
+    }
+    if (low == high) continue;  // empty row
+    const bool at_high = row[width] == high;
+    if (!at_high && row[width] != low) continue;
+    for (int j = 0; j < width; ++j) {
+      if (row[j] == 0) continue;
+      // At the top every positive coefficient's variable is a mine, at the bottom every negative one's
+      const signed char mine = ((row[j] > 0) == at_high) ? 1 : 0;
+      if (value[columns_of[j]] == -1) {
+        value[columns_of[j]] = mine;
+        fixed = true;
+      }
+    }
+  }
+  return fixed;
+}
+
+static int find_root(std::vector<int> &parent, int v) {
+  while (parent[v] != v) v = parent[v] = parent[parent[v]];
+  return v;
+}
+
+/**
+ * Split the constraints into connected groups (constraints sharing a variable) and eliminate each one.
+ */
+static bool eliminate_groups(const std::vector<Constraint> &constraints, std::vector<signed char> &value,
+                             DeductionScratch &scratch) {
+  std::vector<int> &parent = scratch.parent;
+  parent.resize(value.size());
+  std::iota(parent.begin(), parent.end(), 0);
+  for (const auto &constraint : constraints) {
+    int first = -1;
+    for_each_bit(constraint.cells, [&](int v) {
+      if (first == -1) first = v; else parent[find_root(parent, v)] = find_root(parent, first);
+    });
+  }
+  std::vector<std::vector<int>> &groups = scratch.groups;
+  reset_lists(groups, value.size());
+  for (int i = 0; i < static_cast<int>(constraints.size()); ++i) {
+    int first = -1;
+    for_each_bit(constraints[i].cells, [&](int v) { if (first == -1) first = v; });
+    groups[find_root(parent, first)].push_back(i);
+  }
+  bool fixed = false;
+  for (size_t root = 0; root < value.size(); ++root) {
+    if (groups[root].size() > 1) fixed |= eliminate_group(constraints, groups[root], value, scratch);
+  }
+  return fixed;
+}
+
+/*
+ * Exact frontier probabilities.
+ * The frontier variables split into components that share no constraint. Every component small enough is enumerated
+ * by backtracking, counting its consistent assignments by the number of mines they use. The per-component counts are
+ * then convolved and weighted by the ways to place the remaining mines among the interior unknowns (those next to no
+ * number), which gives each unknown cell its true mine probability given total_mines.
+ *
+ * Counts grow like binomials, so every distribution is kept scaled to a largest value of 1 with its logarithmic scale
+ * alongside, and the interior weights C(interior, rest) are formed in log space. Most components are unchanged from one
+ * move to the next, and small ones recur across games, so their counts are kept in a ComponentCache (component_cache.h)
+ * under a key that does not depend on where the component lies on the board. Near the end of
+ * the game the mine count itself can force cells: a mine count of a component that no completion fits rules out all
+ * its assignments, and the interior is all safe or all mines when every feasible total leaves it none or full.
+ */
+static constexpr int kMaxEnumerationVariables = 64;      // larger components fall back to local estimates
+static constexpr long kMaxEnumerationNodes = 1L << 20;   // search nodes per component before falling back
+static constexpr int kMinCachedVariables = 8;            // smaller components are enumerated faster than keyed
+
+struct ComponentCounts {
+  std::vector<int> variables;     // frontier variables of the component
+  std::vector<double> ways;       // ways[k]: consistent assignments with k mines
+  std::vector<double> cell_ways;  // cell_ways[k * size + i]: those of them where variables[i] is a mine
+};
+
+// A distribution over mine counts, equal to values * exp(log_scale)
+struct ScaledCounts {
+  std::vector<double> values;
+  double log_scale = 0.0;
+};
+
+struct EnumerationState {
+  std::vector<std::vector<int>> touching;  // local variable -> local constraints containing it
+  std::vector<int> target;                 // local constraint -> mines it needs
+  std::vector<int> assigned;               // local constraint -> mines assigned so far
+  std::vector<int> open;                   // local constraint -> variables not assigned yet
+  std::vector<signed char> assignment;     // local variable -> 0 / 1
+  long nodes = 0;
+  ComponentCounts *counts = nullptr;
+};
+
+// Storage of estimate_mine_probabilities() and the component solvers, kept from one move to the next like
+// DeductionScratch
+struct ProbabilityScratch {
+  std::vector<std::vector<int>> covering;  // variable -> constraints covering it
+  std::vector<uint8_t> variable_seen, constraint_seen;
+  std::vector<ComponentCounts> components;  // the enumerated components, then spares
+  std::vector<int> component_constraints;
+  std::vector<ScaledCounts> scaled, prefix, suffix;
+  ScaledCounts others;
+  std::vector<double> weight;
+  std::vector<std::vector<uint8_t>> possible, prefix_possible, suffix_possible;
+  std::vector<uint8_t> others_possible, can_be_mine, can_be_safe;
+  EnumerationState enumeration;
+  std::vector<int> local;  // frontier variable -> variable of the component being counted
+  // Keying a component for the component cache
+  std::vector<int> sorted, descriptions, key, order, rank;
+  std::vector<std::pair<int, int>> positions;
+  CanonicalScratch canonical;
+  SolvedComponent solved;
+};
+
+// Storage of choose_sampled_guess(), kept from one guess to the next like DeductionScratch
+struct SampledGuessScratch {
+  SamplingProblem problem;
+  std::vector<std::vector<int>> spare_lists;  // variable lists of dropped constraints and candidates, for new ones
+  SamplerScratch sampler;
+  SamplerResult result;
+  std::vector<int> cells;  // frontier cells, then the interior candidate
+  std::vector<double> risk;
+};
+
+static bool enumerate_assignments(EnumerationState &state, int i, int mines) {
+  if (++state.nodes > kMaxEnumerationNodes) return false;
+  const int size = static_cast<int>(state.assignment.size());
+  if (i == size) {
+    state.counts->ways[mines] += 1.0;
+    for (int j = 0; j < size; ++j) state.counts->cell_ways[mines * size + j] += state.assignment[j];
+    return true;
+  }
+  for (int mine = 0; mine <= 1; ++mine) {
+    bool feasible = true;
+    for (int k : state.touching[i]) {
+      --state.open[k];
+      state.assigned[k] += mine;
+      if (state.assigned[k] > state.target[k] || state.assigned[k] + state.open[k] < state.target[k]) feasible = false;
+    }
+    state.assignment[i] = static_cast<signed char>(mine);
+    const bool finished = !feasible || enumerate_assignments(state, i + 1, mines + mine);
+    for (int k : state.touching[i]) {
+      ++state.open[k];
+      state.assigned[k] -= mine;
+    }
+    if (!finished) return false;
+  }
+  return true;
+}
+
+// The convolutions below write into `result`, which must be neither of the inputs, so that its storage is reused
+static void convolve(const std::vector<double> &a, const std::vector<double> &b, std::vector<double> &result) {
+  result.assign(a.size() + b.size() - 1, 0.0);
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i] == 0.0) continue;
+    for (size_t j = 0; j < b.size(); ++j) result[i + j] += a[i] * b[j];
+  }
+}
+
+// Scale the values to a largest value of 1
+static void rescale(ScaledCounts &counts) {
+  const double top = counts.values.empty() ? 0.0 : *std::max_element(counts.values.begin(), counts.values.end());
+  if (top > 0.0) {
+    for (double &value : counts.values) value /= top;
+    counts.log_scale += std::log(top);
+  }
+}
+
+static void convolve(const ScaledCounts &a, const ScaledCounts &b, ScaledCounts &result) {
+  convolve(a.values, b.values, result.values);
+  result.log_scale = a.log_scale + b.log_scale;
+  rescale(result);
+}
+
+// Mine counts reachable by the sum of two components, given those each of them can reach
+static void convolve_support(const std::vector<uint8_t> &a, const std::vector<uint8_t> &b,
+                             std::vector<uint8_t> &result) {
+  result.assign(a.size() + b.size() - 1, 0);
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (!a[i]) continue;
+    for (size_t j = 0; j < b.size(); ++j) result[i + j] |= b[j];
+  }
+}
+
+static inline double log_choose(int n, int k) {
+  return std::lgamma(n + 1.0) - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0);
+}
+
+/**
+ * Switches for the analysis steps of GameClient::Decide(), so that weaker variants can be benchmarked against the full
+ * solver.
+ */
+struct ClientOptions {
+  bool pattern_table = true;        // look frontier windows up in pattern_table.h before the solvers (pattern.h)
+  bool constraint_engine = true;    // run deduce_frontier() once the single-cell rules are exhausted
+  bool exact_probabilities = true;  // enumerate frontier components instead of only averaging local densities
+  bool contradiction_probing = true;  // try each frontier cell both ways before guessing (see probe_frontier())
+  bool monte_carlo = true;            // sample layouts when a component was too large to enumerate (sampler.h)
+  SamplerOptions sampler;             // set chains and samples_per_chain, with no time budget, for repeatable games
+  bool component_cache = true;        // look solved components up before enumerating them (component_cache.h)
+  // The cache to use, e.g. one shared by every game of a batch; if null, each client makes its own of this size
+  std::shared_ptr<ComponentCache> shared_component_cache;
+  size_t component_cache_bytes = kDefaultComponentCacheBytes;
+};
+
+// Candidates whose risk is within this of the lowest one compete on expected information gain
+constexpr double kGuessRiskTolerance = 0.02;
+
+// What the padding around the client's board shows: neither unknown, marked nor a number
+constexpr char kBorderCell = '#';
+// Rings of padding: two, so that the 5x5 windows of pattern.h never leave the grid either
+constexpr int kBorderWidth = 2;
+
+/**
+ * One game as seen by the player. Everything the solver knows or caches lives in the instance, so independent games
+ * can be played side by side (see TestBatchParallel() in advanced.cpp). The free functions InitGame(), ReadMap(),
+ * ReadMapView() and Decide() of client.h drive a default instance wired to Execute().
+ *
+ * The per-cell state is stored in flat arrays over the board padded with kBorderWidth rings of kBorderCell, so cell
+ * (r, c) has index (r + kBorderWidth) * stride_ + c + kBorderWidth and its neighbours sit at the fixed offsets of
+ * neighbor_offsets_. The padding never matches '?', '@' or a digit, so neighbour loops need neither bounds checks nor
+ * allocations.
+ */
+class GameClient {
+ public:
+  using Executor = std::function<void(int r, int c, int type)>;
+
+  /**
+   * @param execute Called once per Decide() with the same arguments as Execute(). It must apply the operation and,
+   * unless the game ended, feed the resulting map back through ReadMap() or ReadMapView().
+   */
+  explicit GameClient(Executor execute, ClientOptions options = {})
+      : execute_(std::move(execute)), options_(std::move(options)) {
+    if (options_.component_cache) {
+      component_cache_ = options_.shared_component_cache != nullptr
+                             ? options_.shared_component_cache
+                             : std::make_shared<ComponentCache>(options_.component_cache_bytes);
+    }
+  }
+
+  void InitGame(int rows, int columns, int total_mines, int first_row, int first_column);
+  void ReadMap(std::istream &in);
+  void ReadMapView(const char *frame);
+  void Decide();
+
+  // Decisions of the current game that had to guess (step 3 of Decide())
+  int guess_count() const { return guess_count_; }
+
+ private:
+  int cell_index(int r, int c) const { return (r + kBorderWidth) * stride_ + c + kBorderWidth; }
+  int first_cell() const { return kBorderWidth * stride_; }              // first cell of board row 0
+  int end_cell() const { return (rows_ + kBorderWidth) * stride_; }      // past the last cell of the last board row
+  void execute_cell(int cell, int type) {
+    execute_(cell / stride_ - kBorderWidth, cell % stride_ - kBorderWidth, type);
+  }
+  template <typename Visitor>
+  void for_each_neighbor(int cell, Visitor &&visit) const;
+  int board_neighbor_count(int cell) const;
+  void mark_dirty(int cell);
+  void apply_cell_change(int cell, char before, char now);
+  void update_observed_row(int r, const char *line);
+  bool plan_pattern_deductions();
+  void collect_constraints(std::vector<Constraint> &constraints);
+  void deduce_frontier();
+  bool count_component(const std::vector<Constraint> &constraints, const std::vector<int> &component_constraints,
+                       ComponentCounts &counts);
+  bool solve_component(const std::vector<Constraint> &constraints, const std::vector<int> &component_constraints,
+                       ComponentCounts &counts);
+  void estimate_mine_probabilities();
+  bool plan_mine_count_deductions();
+  bool choose_sampled_guess(int &best_cell);
+  KnowledgeFork fork_knowledge() const;
+  void assume_cell(int cell, char now);
+  void rollback_knowledge(const KnowledgeFork &fork);
+  bool assumption_contradicts(int cell, char assumed);
+  void probe_frontier();
+  bool planned_action_applies(const PlannedAction &action) const;
+  bool execute_planned_action();
+
+  Executor execute_;
+  ClientOptions options_;
+  int guess_count_ = 0;
+  int rows_ = 0;
+  int columns_ = 0;
+  int stride_ = 0;  // columns_ + 2 * kBorderWidth
+  int total_mines_ = 0;
+  int neighbor_offsets_[8] = {};
+  int pattern_offsets_[kPatternCells] = {};  // cells of the 5x5 window around a cell, in row-major order
+  // Client-side observed map of the current game state, padded with kBorderCell
+  std::string observed_map_;
+  // Per-cell neighbour counters, kept up to date from the map diff in ReadMap()
+  std::vector<int> marked_around_;   // '@' neighbours of each cell
+  std::vector<int> unknown_around_;  // '?' neighbours of each cell
+  // Numbered cells whose neighbourhood changed since they were last evaluated by Decide()
+  std::vector<int> dirty_cells_;
+  std::vector<uint8_t> is_dirty_;
+  // Cells whose 5x5 window changed since plan_pattern_deductions() last looked them up
+  std::vector<int> pattern_cells_;
+  std::vector<uint8_t> pattern_queued_;
+  // Frontier numbering and results of the linear constraint engine
+  std::vector<int> frontier_cells_;               // frontier variable -> cell
+  std::vector<int> frontier_index_;               // cell -> frontier variable, -1 elsewhere
+  std::vector<int> proven_safe_;                  // output of the last deduce_frontier() call
+  std::vector<int> proven_mines_;                 // output of the last deduce_frontier() call
+  std::vector<double> mine_probability_;          // frontier variable -> mine probability
+  double interior_probability_ = 0.0;             // mine probability of every unknown off the frontier
+  std::vector<bool> approximated_;                // frontier variable -> probability only locally estimated
+  int approximated_count_ = 0;
+  std::vector<int> count_forced_;                 // frontier variable -> 0 / 1 if the mine count forces it, else -1
+  int interior_forced_ = -1;                      // 0 / 1 if the mine count forces every interior unknown, else -1
+  std::shared_ptr<ComponentCache> component_cache_;  // null if options_.component_cache is off
+  // Actions proven by earlier analyses, replayed first: planned_actions_[planned_head_, size) are still waiting
+  std::vector<PlannedAction> planned_actions_;
+  size_t planned_head_ = 0;
+  // Hypothetical edits since the outermost open fork, and the numbered cells a probe still has to check
+  std::vector<KnowledgeEdit> undo_log_;
+  std::vector<int> probe_worklist_;
+  // Scratch storage of the analysis steps. It only ever grows, so once a client has played a game or two on a board
+  // size its moves stop allocating.
+  std::vector<Constraint> constraints_;  // of the last collect_constraints() call
+  uint64_t constraint_builds_ = 0;       // collect_constraints() calls so far, to tell forks that rebuilt them
+  DeductionScratch deduction_;
+  ProbabilityScratch probability_;
+  SampledGuessScratch sampled_guess_;
+};
+
+template <typename Visitor>
+inline void GameClient::for_each_neighbor(int cell, Visitor &&visit) const {
+  for (int offset : neighbor_offsets_) visit(cell + offset);
+}
+
+/**
+ * Number of neighbours of a cell that lie on the board.
+ */
+inline int GameClient::board_neighbor_count(int cell) const {
+  int count = 0;
+  for_each_neighbor(cell, [&](int n) { count += observed_map_[n] != kBorderCell; });
+  return count;
+}
+
+/**
+ * Queue a numbered cell for re-evaluation by Decide().
+ */
+inline void GameClient::mark_dirty(int cell) {
+  if (is_dirty_[cell] || !is_number(observed_map_[cell])) return;
+  is_dirty_[cell] = 1;
+  dirty_cells_.push_back(cell);
+}
+
+/**
+ * Record that a cell now shows `now` instead of `before`, updating the neighbour counters and queueing every numbered
+ * cell whose deductions may have changed. The counters of the padding ring are updated too and simply never read.
+ */
+inline void GameClient::apply_cell_change(int cell, char before, char now) {
+  observed_map_[cell] = now;
+  const int unknown_delta = (now == '?') - (before == '?');
+  const int marked_delta = (now == '@') - (before == '@');
+  for_each_neighbor(cell, [&](int n) {
+    unknown_around_[n] += unknown_delta;
+    marked_around_[n] += marked_delta;
+    mark_dirty(n);
+  });
+  mark_dirty(cell);
+}
+
+/**
+ * Diff one freshly read row against the observed map and apply the cells that changed.
+ */
+inline void GameClient::update_observed_row(int r, const char *line) {
+  const int start = cell_index(r, 0);
+  if (observed_map_.compare(start, columns_, line, columns_) == 0) return;
+  for (int c = 0; c < columns_; ++c) {
+    if (observed_map_[start + c] == line[c]) continue;
+    apply_cell_change(start + c, observed_map_[start + c], line[c]);
+    // Every window containing the cell changed, so their centres have to be looked up again
+    for (int offset : pattern_offsets_) {
+      const int n = start + c + offset;
+      if (pattern_queued_[n]) continue;
+      pattern_queued_[n] = 1;
+      pattern_cells_.push_back(n);
+    }
+  }
+}
+
+/**
+ * Reset every piece of per-game state for a rows x columns board and play the given first move.
+ */
+inline void GameClient::InitGame(int rows, int columns, int total_mines, int first_row, int first_column) {
+  rows_ = rows;
+  columns_ = columns;
+  stride_ = columns_ + 2 * kBorderWidth;
+  total_mines_ = total_mines;
+  const int offsets[8] = {-stride_ - 1, -stride_, -stride_ + 1, -1, 1, stride_ - 1, stride_, stride_ + 1};
+  std::copy(offsets, offsets + 8, neighbor_offsets_);
+  for (int i = 0; i < kPatternCells; ++i) {
+    pattern_offsets_[i] = (i / kPatternSize - kPatternSize / 2) * stride_ + i % kPatternSize - kPatternSize / 2;
+  }
+  const size_t cells = static_cast<size_t>(rows_ + 2 * kBorderWidth) * stride_;
+  observed_map_.assign(cells, kBorderCell);
+  for (int r = 0; r < rows_; ++r) observed_map_.replace(cell_index(r, 0), columns_, columns_, '?');
+  marked_around_.assign(cells, 0);
+  unknown_around_.assign(cells, 0);
+  for (int cell = first_cell(); cell < end_cell(); ++cell) {
+    if (observed_map_[cell] == '?') unknown_around_[cell] = board_neighbor_count(cell);
+  }
+  dirty_cells_.clear();
+  is_dirty_.assign(cells, 0);
+  pattern_cells_.clear();
+  pattern_queued_.assign(cells, 0);
+  frontier_cells_.clear();
+  frontier_index_.assign(cells, -1);
+  planned_actions_.clear();
+  planned_head_ = 0;
+  guess_count_ = 0;
+  execute_(first_row, first_column, 0);
+}
+
+/**
+ * Read the map as printed by PrintMap() from the given stream.
+ */
+inline void GameClient::ReadMap(std::istream &in) {
+  PROFILE_SCOPE(kTimeReadMap);
+  std::string line;
+  for (int r = 0; r < rows_; ++r) {
+    in >> line;
+    // Defensive: ensure size matches columns
+    if (static_cast<int>(line.size()) < columns_) {
+      line.resize(columns_, '?');
+    }
+    update_observed_row(r, line.data());
+  }
+}
+
+/**
+ * Read the map from a frame laid out like the output of PrintMap().
+ */
+inline void GameClient::ReadMapView(const char *frame) {
+  PROFILE_SCOPE(kTimeReadMap);
+  for (int r = 0; r < rows_; ++r) {
+    update_observed_row(r, frame + static_cast<size_t>(r) * (columns_ + 1));
+  }
+}
+
+/**
+ * Look the windows that changed since the last call up in the pattern table (pattern.h) and plan the forced centres.
+ * A window that missed stays a miss until one of its cells changes, so each one is looked up once per change. Returns
+ * whether anything was planned.
+ */
+inline bool GameClient::plan_pattern_deductions() {
+  PROFILE_SCOPE(kTimePatternLookup);
+  bool planned = false;
+  uint8_t window[kPatternCells];
+  for (int cell : pattern_cells_) {
+    pattern_queued_[cell] = 0;
+    if (observed_map_[cell] != '?') continue;
+    bool frontier = false;
+    for_each_neighbor(cell, [&](int n) { frontier |= is_number(observed_map_[n]); });
+    if (!frontier) continue;
+    for (int i = 0; i < kPatternCells; ++i) {
+      const int n = cell + pattern_offsets_[i];
+      const char ch = observed_map_[n];
+      window[i] = ch == '?' ? kPatternUnknown : kPatternInert;
+      if (((pattern_detail::kTables.inner >> i) & 1) && is_number(ch)) {
+        window[i] = static_cast<uint8_t>(kPatternNumber + (ch - '0') - marked_around_[n]);
+      }
+    }
+    if (!NormalizePattern(window)) continue;
+    const int verdict = PatternLookup(PatternKey(window));
+    if (verdict == -1) continue;
+    planned_actions_.push_back({cell, verdict});  // visit a safe centre, mark a mine
+    planned = true;
+  }
+  pattern_cells_.clear();
+  return planned;
+}
+
+/**
+ * Number the frontier unknowns and turn every number that still has unknown neighbours into a constraint.
+ */
+inline void GameClient::collect_constraints(std::vector<Constraint> &constraints) {
+  ++constraint_builds_;
+  for (int cell : frontier_cells_) frontier_index_[cell] = -1;
+  frontier_cells_.clear();
+  for (int cell = first_cell(); cell < end_cell(); ++cell) {
+    if (!is_number(observed_map_[cell]) || unknown_around_[cell] == 0) continue;
+    for_each_neighbor(cell, [&](int n) {
+      if (observed_map_[n] == '?' && frontier_index_[n] == -1) {
+        frontier_index_[n] = static_cast<int>(frontier_cells_.size());
+        frontier_cells_.push_back(n);
+      }
+    });
+  }
+  const size_t words = (frontier_cells_.size() + 63) / 64;
+  size_t count = 0;
+  for (int cell = first_cell(); cell < end_cell(); ++cell) {
+    if (!is_number(observed_map_[cell]) || unknown_around_[cell] == 0) continue;
+    if (count == constraints.size()) resize_constraints(constraints, count + 1, deduction_.spare_bits);
+    Constraint &constraint = constraints[count++];
+    constraint.cells.assign(words, 0);
+    constraint.mines = (observed_map_[cell] - '0') - marked_around_[cell];
+    for_each_neighbor(cell, [&](int n) {
+      if (observed_map_[n] == '?') bits_set(constraint.cells, frontier_index_[n]);
+    });
+  }
+  resize_constraints(constraints, count, deduction_.spare_bits);
+}
+
+/**
+ * Find every frontier cell that is provably safe or provably a mine, filling proven_safe_ and proven_mines_.
+ */
+inline void GameClient::deduce_frontier() {
+  PROFILE_SCOPE(kTimeDeduceFrontier);
+  proven_safe_.clear();
+  proven_mines_.clear();
+  std::vector<Constraint> &constraints = constraints_;
+  collect_constraints(constraints);
+  const int variables = static_cast<int>(frontier_cells_.size());
+  if (variables == 0) return;
+  DeductionScratch &scratch = deduction_;
+  std::vector<signed char> &value = scratch.value;
+  value.assign(variables, -1);
+  bool gaussian_done = false;
+  while (true) {
+    // Substitute fixed variables, drop emptied and repeated constraints, and apply the trivial rules
+    scratch.seen.Clear((variables + 63) / 64);
+    bool fixed = false;
+    size_t kept = 0;
+    for (size_t i = 0; i < constraints.size(); ++i) {
+      Constraint &constraint = constraints[i];
+      int size = 0;
+      for_each_bit(constraint.cells, [&](int v) {
+        if (value[v] == -1) {
+          ++size;
+          return;
+        }
+        constraint.mines -= value[v];
+        constraint.cells[v / 64] &= ~(uint64_t{1} << (v % 64));
+      });
+      if (size == 0 || !scratch.seen.Insert(constraint.cells)) continue;
+      if (constraint.mines == 0 || constraint.mines == size) {
+        const signed char mine = constraint.mines == 0 ? 0 : 1;
+        for_each_bit(constraint.cells, [&](int v) { value[v] = mine; });
+        fixed = true;
+        continue;
+      }
+      if (kept != i) std::swap(constraints[kept], constraint);  // a swap keeps both bit sets' storage
+      ++kept;
+    }
+    resize_constraints(constraints, kept, scratch.spare_bits);
+    if (fixed) continue;
+    if (reduce_subsets(constraints, scratch, variables)) continue;
+    if (gaussian_done || !eliminate_groups(constraints, value, scratch)) break;
+    gaussian_done = true;
+  }
+  for (int v = 0; v < variables; ++v) {
+    if (value[v] == 0) proven_safe_.push_back(frontier_cells_[v]);
+    if (value[v] == 1) proven_mines_.push_back(frontier_cells_[v]);
+  }
+}
+
+/**
+ * Count the assignments of one component. Returns false if the search exceeds kMaxEnumerationNodes.
+ */
+inline bool GameClient::count_component(const std::vector<Constraint> &constraints,
+                                        const std::vector<int> &component_constraints, ComponentCounts &counts) {
+  const int size = static_cast<int>(counts.variables.size());
+  std::vector<int> &local = probability_.local;
+  local.assign(frontier_cells_.size(), -1);
+  for (int i = 0; i < size; ++i) local[counts.variables[i]] = i;
+  EnumerationState &state = probability_.enumeration;
+  reset_lists(state.touching, size);
+  state.target.clear();
+  state.assigned.clear();
+  state.open.clear();
+  state.nodes = 0;
+  for (int k = 0; k < static_cast<int>(component_constraints.size()); ++k) {
+    const Constraint &constraint = constraints[component_constraints[k]];
+    int open = 0;
+    for_each_bit(constraint.cells, [&](int v) {
+      state.touching[local[v]].push_back(k);
+      ++open;
+    });
+    state.target.push_back(constraint.mines);
+    state.assigned.push_back(0);
+    state.open.push_back(open);
+  }
+  state.assignment.assign(size, 0);
+  state.counts = &counts;
+  counts.ways.assign(size + 1, 0.0);
+  counts.cell_ways.assign(static_cast<size_t>(size + 1) * size, 0.0);
+  return enumerate_assignments(state, 0, 0);
+}
+
+/**
+ * count_component() through the component cache (see component_cache.h). For a cached size, counts.variables comes
+ * back in canonical order either way, so the result does not depend on whether the cache knew the component. Returns
+ * false if the component is too hard to enumerate.
+ */
+inline bool GameClient::solve_component(const std::vector<Constraint> &constraints,
+                                        const std::vector<int> &component_constraints, ComponentCounts &counts) {
+  if (component_cache_ == nullptr || static_cast<int>(counts.variables.size()) < kMinCachedVariables) {
+    return count_component(constraints, component_constraints, counts);
+  }
+  // Describe the component over its variables in ascending order
+  ProbabilityScratch &scratch = probability_;
+  std::vector<int> &sorted = scratch.sorted;
+  sorted.assign(counts.variables.begin(), counts.variables.end());
+  std::sort(sorted.begin(), sorted.end());
+  auto local = [&](int v) {
+    return static_cast<int>(std::lower_bound(sorted.begin(), sorted.end(), v) - sorted.begin());
+  };
+  scratch.positions.clear();
+  for (int v : sorted) scratch.positions.push_back({frontier_cells_[v] / stride_, frontier_cells_[v] % stride_});
+  std::vector<int> &descriptions = scratch.descriptions;
+  descriptions.clear();
+  for (int k : component_constraints) {
+    descriptions.push_back(bits_count(constraints[k].cells));
+    descriptions.push_back(constraints[k].mines);
+    for_each_bit(constraints[k].cells, [&](int v) { descriptions.push_back(local(v)); });
+  }
+  std::vector<int> &key = scratch.key, &order = scratch.order;
+  CanonicalComponent(scratch.positions, descriptions, key, order, scratch.canonical);
+
+  SolvedComponent &solved = scratch.solved;
+  if (!component_cache_->Find(key, solved)) {
+    solved.solved = count_component(constraints, component_constraints, counts);
+    if (solved.solved) {
+      // Move the variables from enumeration order to canonical order
+      const int size = static_cast<int>(counts.variables.size());
+      std::vector<int> &rank = scratch.rank;
+      rank.resize(size);
+      for (int i = 0; i < size; ++i) rank[order[i]] = i;
+      solved.ways.assign(counts.ways.begin(), counts.ways.end());
+      solved.cell_ways.assign(counts.cell_ways.size(), 0.0);
+      for (int i = 0; i < size; ++i) {
+        const int r = rank[local(counts.variables[i])];
+        for (int k = 0; k <= size; ++k) solved.cell_ways[k * size + r] = counts.cell_ways[k * size + i];
+      }
+    }
+    component_cache_->Insert(key, solved);
+  }
+  if (!solved.solved) return false;
+  for (size_t i = 0; i < order.size(); ++i) counts.variables[i] = sorted[order[i]];
+  counts.ways.swap(solved.ways);  // swaps rather than moves, so that neither side loses its storage
+  counts.cell_ways.swap(solved.cell_ways);
+  return true;
+}
+
+/**
+ * Fill mine_probability_ for every frontier variable and interior_probability_ for the cells off the frontier, and
+ * record in count_forced_ and interior_forced_ what the mine count alone decides.
+ */
+inline void GameClient::estimate_mine_probabilities() {
+  PROFILE_SCOPE(kTimeProbabilities);
+  std::vector<Constraint> &constraints = constraints_;
+  collect_constraints(constraints);
+  ProbabilityScratch &scratch = probability_;
+  const int variables = static_cast<int>(frontier_cells_.size());
+  mine_probability_.assign(variables, 0.0);
+  approximated_.assign(variables, false);
+  approximated_count_ = 0;
+  count_forced_.assign(variables, -1);
+  interior_forced_ = -1;
+  const int unknown_total = static_cast<int>(std::count(observed_map_.begin(), observed_map_.end(), '?'));
+  const int marked_total = static_cast<int>(std::count(observed_map_.begin(), observed_map_.end(), '@'));
+  const int interior = unknown_total - variables;
+  const int mines_left = total_mines_ - marked_total;
+
+  // Split the frontier into components, visiting variables in breadth-first order so that constraints close early
+  // during enumeration
+  std::vector<std::vector<int>> &covering = scratch.covering;
+  reset_lists(covering, variables);
+  for (int i = 0; i < static_cast<int>(constraints.size()); ++i) {
+    for_each_bit(constraints[i].cells, [&](int v) { covering[v].push_back(i); });
+  }
+  std::vector<uint8_t> &variable_seen = scratch.variable_seen, &constraint_seen = scratch.constraint_seen;
+  variable_seen.assign(variables, 0);
+  constraint_seen.assign(constraints.size(), 0);
+  std::vector<ComponentCounts> &components = scratch.components;
+  std::vector<int> &component_constraints = scratch.component_constraints;
+  int count = 0;  // components enumerated, components[0, count)
+  double approximate_mines = 0.0;
+  for (int start = 0; start < variables; ++start) {
+    if (variable_seen[start]) continue;
+    if (count == static_cast<int>(components.size())) components.emplace_back();
+    ComponentCounts &counts = components[count];
+    counts.variables.clear();
+    component_constraints.clear();
+    variable_seen[start] = 1;
+    counts.variables.push_back(start);
+    for (size_t head = 0; head < counts.variables.size(); ++head) {
+      for (int k : covering[counts.variables[head]]) {
+        if (constraint_seen[k]) continue;
+        constraint_seen[k] = 1;
+        component_constraints.push_back(k);
+        for_each_bit(constraints[k].cells, [&](int v) {
+          if (!variable_seen[v]) {
+            variable_seen[v] = 1;
+            counts.variables.push_back(v);
+          }
+        });
+      }
+    }
+    if (options_.exact_probabilities && static_cast<int>(counts.variables.size()) <= kMaxEnumerationVariables &&
+        solve_component(constraints, component_constraints, counts)) {
+      ++count;
+      continue;
+    }
+    // Too large to enumerate: average the local densities of the constraints around each variable
+    for (int v : counts.variables) {
+      double density = 0.0;
+      for (int k : covering[v]) density += static_cast<double>(constraints[k].mines) / bits_count(constraints[k].cells);
+      mine_probability_[v] = density / covering[v].size();
+      approximate_mines += mine_probability_[v];
+      approximated_[v] = true;
+      ++approximated_count_;
+    }
+  }
+  // prefix[i] / suffix[i]: mine count distribution of components before i / from i on
+  std::vector<ScaledCounts> &scaled = scratch.scaled, &prefix = scratch.prefix, &suffix = scratch.suffix;
+  scaled.resize(std::max<size_t>(scaled.size(), count));
+  prefix.resize(std::max<size_t>(prefix.size(), count + 1));
+  suffix.resize(std::max<size_t>(suffix.size(), count + 1));
+  prefix[0].values.assign(1, 1.0);
+  prefix[0].log_scale = 0.0;
+  suffix[count].values.assign(1, 1.0);
+  suffix[count].log_scale = 0.0;
+  for (int i = 0; i < count; ++i) {
+    scaled[i].values.assign(components[i].ways.begin(), components[i].ways.end());
+    scaled[i].log_scale = 0.0;
+    rescale(scaled[i]);
+  }
+  for (int i = 0; i < count; ++i) convolve(prefix[i], scaled[i], prefix[i + 1]);
+  for (int i = count - 1; i >= 0; --i) convolve(scaled[i], suffix[i + 1], suffix[i]);
+
+  // weight[K]: relative ways to put the other mines in the interior when the enumerated components hold K mines
+  const int budget = mines_left - static_cast<int>(std::lround(approximate_mines));
+  const std::vector<double> &total = prefix[count].values;
+  std::vector<double> &weight = scratch.weight;
+  weight.assign(total.size(), 0.0);
+  double max_log = -1e300;
+  for (int k = 0; k < static_cast<int>(total.size()); ++k) {
+    const int rest = budget - k;
+    if (rest >= 0 && rest <= interior) max_log = std::max(max_log, log_choose(interior, rest));
+  }
+  double normalizer = 0.0, interior_mines = 0.0;
+  for (int k = 0; k < static_cast<int>(total.size()); ++k) {
+    const int rest = budget - k;
+    if (rest < 0 || rest > interior) continue;
+    weight[k] = std::exp(log_choose(interior, rest) - max_log);
+    normalizer += total[k] * weight[k];
+    interior_mines += total[k] * weight[k] * rest;
+  }
+  if (normalizer <= 0.0) {
+    // The mine count cannot be met exactly (only possible with approximated components): ignore it
+    std::fill(weight.begin(), weight.end(), 1.0);
+    normalizer = 0.0;
+    for (double ways : total) normalizer += ways;
+    interior_mines = normalizer * std::max(0.0, budget - (total.size() - 1) / 2.0);
+  }
+  interior_probability_ = interior > 0 ? std::min(1.0, interior_mines / normalizer / interior) : 0.0;
+
+  for (int i = 0; i < count; ++i) {
+    const ComponentCounts &counts = components[i];
+    const int size = static_cast<int>(counts.variables.size());
+    ScaledCounts &others = scratch.others;
+    convolve(prefix[i], suffix[i + 1], others);
+    // Brings cell_ways * others back to the scale of total
+    const double factor = std::exp(others.log_scale - prefix[count].log_scale) / normalizer;
+    for (int k = 0; k <= size; ++k) {
+      if (counts.ways[k] == 0.0) continue;
+      double scale = 0.0;  // weight of all completions of a k-mine assignment of this component
+      for (size_t j = 0; j < others.values.size(); ++j) scale += others.values[j] * weight[k + j];
+      if (scale == 0.0) continue;
+      for (int v = 0; v < size; ++v) {
+        mine_probability_[counts.variables[v]] += counts.cell_ways[k * size + v] * scale * factor;
+      }
+    }
+  }
+
+  // Endgame: which mine counts the components and the interior can actually take together. Decided on which counts
+  // are possible rather than on the floating-point weights, so that a forced cell is never a rounding artifact.
+  if (approximated_count_ > 0) return;
+  std::vector<std::vector<uint8_t>> &possible = scratch.possible, &prefix_possible = scratch.prefix_possible,
+                                    &suffix_possible = scratch.suffix_possible;
+  possible.resize(std::max<size_t>(possible.size(), count));
+  prefix_possible.resize(std::max<size_t>(prefix_possible.size(), count + 1));
+  suffix_possible.resize(std::max<size_t>(suffix_possible.size(), count + 1));
+  prefix_possible[0].assign(1, 1);
+  suffix_possible[count].assign(1, 1);
+  for (int i = 0; i < count; ++i) {
+    possible[i].clear();
+    for (double ways : components[i].ways) possible[i].push_back(ways > 0.0);
+  }
+  for (int i = 0; i < count; ++i) convolve_support(prefix_possible[i], possible[i], prefix_possible[i + 1]);
+  for (int i = count - 1; i >= 0; --i) convolve_support(possible[i], suffix_possible[i + 1], suffix_possible[i]);
+  auto fits = [&](int k) { return mines_left - k >= 0 && mines_left - k <= interior; };
+  if (interior > 0) {
+    bool interior_mine = false, interior_safe = false;
+    for (int k = 0; k < static_cast<int>(prefix_possible[count].size()); ++k) {
+      if (!prefix_possible[count][k] || !fits(k)) continue;
+      interior_mine |= mines_left - k > 0;
+      interior_safe |= mines_left - k < interior;
+    }
+    if (interior_mine != interior_safe) interior_forced_ = interior_mine ? 1 : 0;
+  }
+  std::vector<uint8_t> &can_be_mine = scratch.can_be_mine, &can_be_safe = scratch.can_be_safe;
+  for (int i = 0; i < count; ++i) {
+    const ComponentCounts &counts = components[i];
+    const int size = static_cast<int>(counts.variables.size());
+    std::vector<uint8_t> &others = scratch.others_possible;
+    convolve_support(prefix_possible[i], suffix_possible[i + 1], others);
+    can_be_mine.assign(size, 0);
+    can_be_safe.assign(size, 0);
+    for (int k = 0; k <= size; ++k) {
+      if (!possible[i][k]) continue;
+      bool feasible = false;
+      for (size_t j = 0; j < others.size() && !feasible; ++j) feasible = others[j] && fits(k + static_cast<int>(j));
+      if (!feasible) continue;
+      for (int v = 0; v < size; ++v) {
+        can_be_mine[v] |= counts.cell_ways[k * size + v] > 0.0;
+        can_be_safe[v] |= counts.cell_ways[k * size + v] < counts.ways[k];
+      }
+    }
+    for (int v = 0; v < size; ++v) {
+      if (can_be_mine[v] != can_be_safe[v]) count_forced_[counts.variables[v]] = can_be_mine[v] ? 1 : 0;
+    }
+  }
+}
+
+/**
+ * Plan the moves estimate_mine_probabilities() found forced by the mine count. Returns whether there were any.
+ */
+inline bool GameClient::plan_mine_count_deductions() {
+  bool planned = false;
+  for (int v = 0; v < static_cast<int>(frontier_cells_.size()); ++v) {
+    if (count_forced_[v] == -1) continue;
+    planned_actions_.push_back({frontier_cells_[v], count_forced_[v]});
+    planned = true;
+  }
+  if (interior_forced_ == -1) return planned;
+  for (int cell = first_cell(); cell < end_cell(); ++cell) {
+    if (observed_map_[cell] != '?' || frontier_index_[cell] != -1) continue;
+    planned_actions_.push_back({cell, interior_forced_});
+    planned = true;
+  }
+  return planned;
+}
+
+/**
+ * Pick a guess with the Monte Carlo evaluator of sampler.h, for when estimate_mine_probabilities() had to fall back to
+ * local estimates. Sampled probabilities replace the approximated ones (exact ones are kept), and among the candidates
+ * within kGuessRiskTolerance of the lowest risk the one with the highest expected information gain wins. Returns false
+ * if the sampler found no layout.
+ */
+inline bool GameClient::choose_sampled_guess(int &best_cell) {
+  PROFILE_SCOPE(kTimeSampledGuess);
+  const std::vector<Constraint> &constraints = constraints_;
+  collect_constraints(constraints_);
+  SampledGuessScratch &scratch = sampled_guess_;
+  SamplingProblem &problem = scratch.problem;
+  std::vector<std::vector<int>> &spare = scratch.spare_lists;
+  for (auto &constraint : problem.constraints) spare.push_back(std::move(constraint.variables));
+  for (auto &candidate : problem.candidates) spare.push_back(std::move(candidate.neighbor_variables));
+  problem.constraints.clear();
+  problem.candidates.clear();
+  // A constraint or a candidate lists at most the 8 neighbours of a cell, so a recycled list never has to grow
+  auto take_list = [&spare] {
+    std::vector<int> list;
+    if (!spare.empty()) {
+      list = std::move(spare.back());
+      spare.pop_back();
+      list.clear();
+    }
+    list.reserve(8);
+    return list;
+  };
+  problem.variables = static_cast<int>(frontier_cells_.size());
+  int unknown_total = 0, marked_total = 0;
+  int interior_cell = -1, fewest_neighbors = 9;
+  for (int cell = first_cell(); cell < end_cell(); ++cell) {
+    if (observed_map_[cell] == '@') ++marked_total;
+    if (observed_map_[cell] != '?') continue;
+    ++unknown_total;
+    if (frontier_index_[cell] != -1) continue;
+    const int neighbor_count = board_neighbor_count(cell);
+    if (neighbor_count < fewest_neighbors) {
+      fewest_neighbors = neighbor_count;
+      interior_cell = cell;
+    }
+  }
+  problem.interior = unknown_total - problem.variables;
+  problem.mines_left = total_mines_ - marked_total;
+  for (const auto &constraint : constraints) {
+    problem.constraints.push_back({take_list(), constraint.mines});
+    for_each_bit(constraint.cells, [&](int v) { problem.constraints.back().variables.push_back(v); });
+  }
+  std::vector<int> &cells = scratch.cells;
+  cells.assign(frontier_cells_.begin(), frontier_cells_.end());
+  if (interior_cell != -1) cells.push_back(interior_cell);
+  for (int i = 0; i < static_cast<int>(cells.size()); ++i) {
+    SamplingProblem::Candidate candidate{i < problem.variables ? i : -1, take_list(), 0};
+    for_each_neighbor(cells[i], [&](int n) {
+      if (observed_map_[n] != '?') return;
+      if (frontier_index_[n] != -1) {
+        candidate.neighbor_variables.push_back(frontier_index_[n]);
+      } else {
+        ++candidate.interior_neighbors;
+      }
+    });
+    problem.candidates.push_back(std::move(candidate));
+  }
+  SamplerOptions sampler = options_.sampler;
+  sampler.seed += static_cast<uint64_t>(guess_count_);
+  SampleLayouts(problem, sampler, scratch.sampler, scratch.result);
+  const SamplerResult &result = scratch.result;
+  if (result.samples == 0) return false;
+
+  std::vector<double> &risk = scratch.risk;
+  risk.resize(cells.size());
+  for (int i = 0; i < static_cast<int>(cells.size()); ++i) {
+    if (i == problem.variables) {
+      risk[i] = result.interior_probability;
+    } else {
+      risk[i] = approximated_[i] ? result.mine_probability[i] : mine_probability_[i];
+    }
+  }
+  const double lowest = *std::min_element(risk.begin(), risk.end());
+  int best = -1;
+  for (int i = 0; i < static_cast<int>(cells.size()); ++i) {
+    if (risk[i] > lowest + kGuessRiskTolerance) continue;
+    if (best == -1 || result.information_gain[i] > result.information_gain[best] ||
+        (result.information_gain[i] == result.information_gain[best] && risk[i] < risk[best])) {
+      best = i;
+    }
+  }
+  best_cell = cells[best];
+  return true;
+}
+
+/**
+ * Open a fork of the current knowledge. Edits made through assume_cell(), actions planned and constraints collected
+ * until the matching rollback_knowledge() are undone by it. No move may be executed inside a fork.
+ */
+inline KnowledgeFork GameClient::fork_knowledge() const {
+  return {undo_log_.size(), dirty_cells_.size(), planned_actions_.size(), constraint_builds_};
+}
+
+/**
+ * Change a cell of the observed map inside a fork, logging what it showed before.
+ */
+inline void GameClient::assume_cell(int cell, char now) {
+  undo_log_.push_back({cell, observed_map_[cell]});
+  apply_cell_change(cell, observed_map_[cell], now);
+}
+
+/**
+ * Undo every edit made since the fork, drop the cells those edits queued on the dirty worklist and the actions
+ * planned from them, and bring the constraint system back in line with the restored map.
+ */
+inline void GameClient::rollback_knowledge(const KnowledgeFork &fork) {
+  while (undo_log_.size() > fork.edits) {
+    const KnowledgeEdit edit = undo_log_.back();
+    undo_log_.pop_back();
+    apply_cell_change(edit.cell, observed_map_[edit.cell], edit.before);
+  }
+  while (dirty_cells_.size() > fork.dirty_cells) {
+    is_dirty_[dirty_cells_.back()] = 0;
+    dirty_cells_.pop_back();
+  }
+  if (planned_actions_.size() > fork.planned_actions) planned_actions_.resize(fork.planned_actions);
+  if (constraint_builds_ != fork.constraint_builds) {
+    collect_constraints(constraints_);
+    constraint_builds_ = fork.constraint_builds;
+  }
+}
+
+/**
+ * Assume an unknown cell is a mine ('@') or safe (kAssumedSafe) and follow the single-cell rules from there. Returns
+ * true if some number ends up with too many or too few possible mines, which proves the opposite of the assumption.
+ * The knowledge state is left as it was.
+ */
+inline bool GameClient::assumption_contradicts(int cell, char assumed) {
+  const KnowledgeFork fork = fork_knowledge();
+  probe_worklist_.clear();
+  auto assume = [&](int assumed_cell, char now) {
+    assume_cell(assumed_cell, now);
+    for_each_neighbor(assumed_cell, [&](int n) {
+      if (is_number(observed_map_[n])) probe_worklist_.push_back(n);
+    });
+  };
+  assume(cell, assumed);
+  bool contradiction = false;
+  int steps = 0;
+  while (!probe_worklist_.empty() && !contradiction && steps < kMaxProbeSteps) {
+    const int number = probe_worklist_.back();
+    probe_worklist_.pop_back();
+    const int remaining = observed_map_[number] - '0' - marked_around_[number];
+    const int unknown = unknown_around_[number];
+    if (remaining < 0 || remaining > unknown) {
+      contradiction = true;
+    } else if (unknown > 0 && (remaining == unknown || remaining == 0)) {
+      const char now = remaining == 0 ? kAssumedSafe : '@';
+      for_each_neighbor(number, [&](int n) {
+        if (observed_map_[n] == '?') {
+          assume(n, now);
+          ++steps;
+        }
+      });
+    }
+  }
+  rollback_knowledge(fork);
+  return contradiction;
+}
+
+/**
+ * Try both values of every frontier cell of the last collect_constraints() call and plan the opposite of any value
+ * that leads to a contradiction. This catches chains of single-cell deductions that the linear engine misses, such as
+ * those through components too large to enumerate.
+ */
+inline void GameClient::probe_frontier() {
+  PROFILE_SCOPE(kTimeProbeFrontier);
+  for (int cell : frontier_cells_) {
+    if (observed_map_[cell] != '?') continue;
+    if (assumption_contradicts(cell, '@')) {
+      planned_actions_.push_back({cell, 0});
+    } else if (assumption_contradicts(cell, kAssumedSafe)) {
+      planned_actions_.push_back({cell, 1});
+    }
+  }
+}
+
+/**
+ * Whether a planned action still does something on the current map. Proven facts never expire, so an action only goes
+ * stale when an earlier action (or the flood fill it caused) already took care of its cell.
+ */
+inline bool GameClient::planned_action_applies(const PlannedAction &action) const {
+  const char ch = observed_map_[action.cell];
+  if (action.type != 2) return ch == '?';
+  return is_number(ch) && unknown_around_[action.cell] > 0 && marked_around_[action.cell] == ch - '0';
+}
+
+/**
+ * Execute the first planned action that still applies. Returns false if the queue ran dry.
+ */
+inline bool GameClient::execute_planned_action() {
+  while (planned_head_ < planned_actions_.size()) {
+    const PlannedAction action = planned_actions_[planned_head_++];
+    if (planned_action_applies(action)) {
+      execute_cell(action.cell, action.type);
+      return true;
+    }
+  }
+  planned_actions_.clear();
+  planned_head_ = 0;
+  return false;
+}
+
+inline void GameClient::Decide() {
+  // Strategy: one action per Decide. Every analysis step queues all the actions it proves, and later calls replay the
+  // queue before analysing again.
+  // Priority:
+  // 0) Replay the planned actions that still apply to the current map
+  // 1) Re-evaluate the numbered cells whose neighbourhood changed: mark the unknown neighbours of a cell where
+  //    (number - marked) == unknown, or auto-explore a cell where marked == number
+  // 2) Look every frontier window up in the pattern table, or else run the linear constraint engine over the whole
+  //    frontier, and plan every proven safe cell and mine
+  // 3) Probe every frontier cell for a contradiction, then visit the unknown cell with the lowest exact mine
+  //    probability
+
+  PROFILE_SCOPE(kTimeDecide);
+
+  // Step 0: replay the queue
+  if (execute_planned_action()) {
+    PROFILE_COUNT(kCountDecideReplayed, 1);
+    return;
+  }
+
+  // Step 1: drain the dirty worklist until a cell yields actions. That cell stays queued, since the actions change
+  // its neighbourhood and it has to be looked at again anyway.
+  while (!dirty_cells_.empty()) {
+    const int cell = dirty_cells_.back();
+    int number_required = observed_map_[cell] - '0';
+    int marked_count = marked_around_[cell];
+    int unknown_count = unknown_around_[cell];
+    if (unknown_count > 0 && (number_required - marked_count) == unknown_count) {
+      for_each_neighbor(cell, [&](int n) {
+        if (observed_map_[n] == '?') planned_actions_.push_back({n, 1});
+      });
+      PROFILE_COUNT(kCountDecideSingleCell, 1);
+      execute_planned_action();
+      return;
+    }
+    if (unknown_count > 0 && marked_count == number_required) {
+      PROFILE_COUNT(kCountDecideSingleCell, 1);
+      execute_cell(cell, 2);  // auto-explore
+      return;
+    }
+    dirty_cells_.pop_back();
+    is_dirty_[cell] = 0;
+  }
+
+  // Step 2: deduce beyond the single-cell rules, first from the pattern table and then with the linear engine
+  if (options_.pattern_table && plan_pattern_deductions() && execute_planned_action()) {
+    PROFILE_COUNT(kCountDecidePattern, 1);
+    return;
+  }
+  if (options_.constraint_engine) {
+    deduce_frontier();
+    for (int cell : proven_safe_) planned_actions_.push_back({cell, 0});
+    for (int cell : proven_mines_) planned_actions_.push_back({cell, 1});
+    if (execute_planned_action()) {
+      PROFILE_COUNT(kCountDecideDeduced, 1);
+      return;
+    }
+  }
+
+  // Step 3: Play what the mine count forces, then probe the frontier. Then visit the unknown with the lowest exact mine
+  // probability. Off the frontier every cell is equally risky, so pick the one with the fewest neighbours, which is the
+  // most likely to open up a region.
+  estimate_mine_probabilities();
+  if (plan_mine_count_deductions() && execute_planned_action()) {
+    PROFILE_COUNT(kCountDecideMineCount, 1);
+    return;
+  }
+  if (options_.contradiction_probing) {
+    probe_frontier();
+    if (execute_planned_action()) {
+      PROFILE_COUNT(kCountDecideProbed, 1);
+      return;
+    }
+  }
+  if (options_.monte_carlo && approximated_count_ > 0) {
+    int cell;
+    if (choose_sampled_guess(cell)) {
+      ++guess_count_;
+      PROFILE_COUNT(kCountGuesses, 1);
+      execute_cell(cell, 0);
+      return;
+    }
+  }
+  double best_risk = 2.0;
+  int best_cell = -1;
+  int fewest_neighbors = 9;
+  for (int cell = first_cell(); cell < end_cell(); ++cell) {
+    if (observed_map_[cell] != '?' || frontier_index_[cell] != -1) continue;
+    const int neighbor_count = board_neighbor_count(cell);
+    if (neighbor_count < fewest_neighbors) {
+      fewest_neighbors = neighbor_count;
+      best_risk = interior_probability_;
+      best_cell = cell;
+    }
+  }
+  for (int v = 0; v < static_cast<int>(frontier_cells_.size()); ++v) {
+    if (mine_probability_[v] < best_risk) {
+      best_risk = mine_probability_[v];
+      best_cell = frontier_cells_[v];
+    }
+  }
+  ++guess_count_;
+  PROFILE_COUNT(kCountGuesses, 1);
+  if (best_cell != -1) {
+    execute_cell(best_cell, 0);
+    return;
+  }
+
+  // Fallback: visit any unknown (should rarely happen)
+  const size_t unknown = observed_map_.find('?');
+  if (unknown != std::string::npos) execute_cell(static_cast<int>(unknown), 0);
+}
+
+#endif
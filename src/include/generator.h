@@ -7,7 +7,14 @@
 #ifndef GENERATOR_H
 #define GENERATOR_H
 
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
 #include <random>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 inline std::mt19937_64 gen;
 
@@ -35,37 +42,117 @@ inline void InitSeed(uint64_t random_seed) {
 }
 
 /**
- * Generate a map.
+ * A generated map kept in memory: the mine layout and the first step that is guaranteed to be safe.
  */
-inline void GenerateMap(int rows, int columns, int mine_count, int min_dist) {
-  std::vector<std::pair<int, int>> available_block;
-  bool map[35][35];
-  int row0 = Random(1, rows - 2, gen);
-  int col0 = Random(1, columns - 2, gen);
+struct GeneratedMap {
+  int rows = 0;
+  int columns = 0;
+  std::vector<uint8_t> mines;  // rows * columns flags in row-major order, 1 for a mine
+  int first_row = 0;
+  int first_column = 0;
+};
+
+/**
+ * How GenerateMapData() picks the mines among the available blocks.
+ *   - kCompatible reproduces the original generator bit for bit: the i-th draw picks the k-th block still available in
+ *     row-major order. A Fenwick tree finds that block in O(log cells) instead of erasing from a vector.
+ *   - kFisherYates swaps each pick with the next unused slot (partial Fisher-Yates). Every draw is O(1), but the same
+ *     seed gives a different (equally uniform) map.
+ */
+enum class MineSelection { kCompatible, kFisherYates };
+
+/**
+ * Generate a map of any size into memory. Draws from the shared generator unless another engine is given, as threads
+ * that generate maps side by side must.
+ */
+inline GeneratedMap GenerateMapData(int rows, int columns, int mine_count, int min_dist,
+                                    MineSelection selection = MineSelection::kCompatible,
+                                    std::mt19937_64 &engine = gen) {
+  GeneratedMap map;
+  map.rows = rows;
+  map.columns = columns;
+  map.mines.assign(static_cast<size_t>(rows) * columns, 0);
+  map.first_row = Random(1, rows - 2, engine);
+  map.first_column = Random(1, columns - 2, engine);
+  std::vector<int> available_block;  // row-major cell indices far enough from the first step
+  available_block.reserve(map.mines.size());
   for (int i = 0; i < rows; ++i) {
     for (int j = 0; j < columns; ++j) {
-      map[i][j] = false;
-      if (Dist(row0, col0, i, j) <= min_dist) {
-        continue;
-      }
-      available_block.emplace_back(i, j);
+      if (Dist(map.first_row, map.first_column, i, j) > min_dist) available_block.push_back(i * columns + j);
+    }
+  }
+  const int cnt = static_cast<int>(available_block.size());
+  if (selection == MineSelection::kFisherYates) {
+    for (int i = 0; i < mine_count; ++i) {
+      const int mine_pos = Random(i, cnt - 1, engine);
+      std::swap(available_block[i], available_block[mine_pos]);
+      map.mines[available_block[i]] = 1;
     }
+    return map;
+  }
+  // tree[i] (1-based) counts the blocks still available in (i - lowbit(i), i]
+  std::vector<int> tree(cnt + 1, 0);
+  for (int i = 1; i <= cnt; ++i) {
+    tree[i] += 1;
+    const int parent = i + (i & -i);
+    if (parent <= cnt) tree[parent] += tree[i];
   }
+  int top_bit = 1;
+  while (top_bit * 2 <= cnt) top_bit *= 2;
   for (int i = 0; i < mine_count; ++i) {
-    auto cnt = available_block.size();
-    auto mine_pos = Random(0, static_cast<int>(cnt) - 1, gen);
-    auto &mine = available_block[mine_pos];
-    map[mine.first][mine.second] = true;
-    available_block.erase(available_block.begin() + mine_pos);
+    int k = Random(0, cnt - i - 1, engine);  // index among the remaining blocks, as with the erased vector
+    int pos = 0;
+    for (int step = top_bit; step > 0; step /= 2) {
+      if (pos + step <= cnt && tree[pos + step] <= k) {
+        pos += step;
+        k -= tree[pos];
+      }
+    }
+    map.mines[available_block[pos]] = 1;  // pos + 1 is the 1-based slot of the block
+    for (int j = pos + 1; j <= cnt; j += j & -j) --tree[j];
   }
-  std::cout << rows << "  " << columns << std::endl;
-  for (int i = 0; i < rows; ++i) {
-    for (int j = 0; j < columns; ++j) {
-      std::cout << (map[i][j] ? 'X' : '.');
+  return map;
+}
+
+/**
+ * Scatter mines over a board too large for GenerateMapData(), for LargeGameServer. Cells are drawn uniformly until
+ * mine_count distinct ones farther than min_dist from the first step are found, so mine_count should stay well below
+ * rows * columns.
+ */
+inline std::vector<std::pair<int, int>> GenerateSparseMines(int rows, int columns, int mine_count, int first_row,
+                                                            int first_column, int min_dist) {
+  std::vector<std::pair<int, int>> mines;
+  mines.reserve(mine_count);
+  std::unordered_set<uint64_t> taken;
+  taken.reserve(mine_count);
+  while (static_cast<int>(mines.size()) < mine_count) {
+    const int r = Random(0, rows - 1, gen), c = Random(0, columns - 1, gen);
+    if (Dist(first_row, first_column, r, c) <= min_dist) continue;
+    if (taken.insert(static_cast<uint64_t>(r) * columns + c).second) mines.emplace_back(r, c);
+  }
+  return mines;
+}
+
+/**
+ * Print a generated map in the format read by InitMap(), followed by the first step.
+ */
+inline void PrintGeneratedMap(const GeneratedMap &map) {
+  std::cout << map.rows << "  " << map.columns << std::endl;
+  std::string line(map.columns, '.');
+  for (int i = 0; i < map.rows; ++i) {
+    for (int j = 0; j < map.columns; ++j) {
+      line[j] = map.mines[static_cast<size_t>(i) * map.columns + j] ? 'X' : '.';
     }
-    std::cout << std::endl;
+    std::cout << line << std::endl;
   }
-  std::cout << row0 << " " << col0 << std::endl;
+  std::cout << map.first_row << " " << map.first_column << std::endl;
+}
+
+/**
+ * Generate a map.
+ */
+inline void GenerateMap(int rows, int columns, int mine_count, int min_dist) {
+  PrintGeneratedMap(GenerateMapData(rows, columns, mine_count, min_dist));
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,379 @@
+/**
+ * A server for very large, sparsely mined boards (think 10000 x 10000), where the dense planes of GameServer and its
+ * full-frame rendering would cost gigabytes and seconds per move.
+ *
+ * The board is cut into 64 x 64 tiles. Mines are kept as one sorted list per tile, so an untouched tile costs only its
+ * slot in the tile table. A tile is allocated the first time a move reaches it, and only then are its bit planes and
+ * adjacency counts built from the mine lists of the tile and its eight neighbours. Memory therefore grows with the
+ * area the game has touched, not with the board.
+ *
+ * Flood fill works per tile with the same bitwise dilation as GameServer. Cells reached across a tile edge are left as
+ * pending bits in the neighbouring tile, and that tile is queued, so the only scratch space is the queue of tile ids.
+ * Output is a viewport: PrintRegion() renders any rectangle of the board without touching tiles.
+ */
+#ifndef LARGE_SERVER_H
+#define LARGE_SERVER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+class LargeGameServer {
+ public:
+  void InitMap(int rows, int columns, const std::vector<std::pair<int, int>> &mines);
+  void VisitBlock(int r, int c);
+  void MarkMine(int r, int c);
+  void AutoExplore(int r, int c);
+  void PrintRegion(std::ostream &out, int top, int left, int height, int width) const;
+
+  int rows() const { return rows_; }
+  int columns() const { return columns_; }
+  int64_t total_mines() const { return total_mines_; }
+  int game_state() const { return game_state_; }
+  int64_t visited_non_mine_count() const { return visited_non_mine_count_; }
+  int64_t marked_correct_mines_count() const { return marked_correct_mines_count_; }
+  int64_t touched_tiles() const { return touched_tiles_; }
+  size_t memory_bytes() const;
+
+ private:
+  static constexpr int kTileBits = 6;
+  static constexpr int kTileSize = 1 << kTileBits;  // a tile row is exactly one 64-bit word
+
+  // Every plane holds one word per tile row, bit c standing for local column c
+  struct Tile {
+    uint64_t mine_bits[kTileSize] = {};
+    uint64_t visited_bits[kTileSize] = {};  // cells outside the board are preset, so nothing ever reaches them
+    uint64_t marked_bits[kTileSize] = {};
+    uint64_t zero_bits[kTileSize] = {};     // set if non-mine with no adjacent mines
+    uint64_t pending_bits[kTileSize] = {};  // flood fill: cells reached but not yet opened
+    uint8_t adjacent_mines[kTileSize * kTileSize] = {};
+    bool queued = false;                    // in flood_queue_
+  };
+
+  bool InBounds(int r, int c) const;
+  size_t TileIndex(int tile_row, int tile_column) const;
+  const Tile *FindTile(int r, int c) const;
+  Tile &TouchTile(int tile_row, int tile_column);
+  void BuildTile(int tile_row, int tile_column, Tile &tile) const;
+  bool IsMine(int r, int c) const;
+  void AddPending(int tile_row, int tile_column, int local_row, uint64_t bits);
+  void FloodVisitFrom(int r, int c);
+  void OpenPendingCells(size_t index);
+  void RecomputeGameWinState();
+  char RenderedCell(int r, int c) const;
+
+  int rows_ = 0;
+  int columns_ = 0;
+  int tile_rows_ = 0;
+  int tile_columns_ = 0;
+  int64_t total_mines_ = 0;
+  int game_state_ = 0;                        // 0 for continuing, 1 for winning, -1 for losing
+  std::vector<uint32_t> mine_offsets_;        // mines of tile t are mine_cells_[mine_offsets_[t], mine_offsets_[t + 1])
+  std::vector<uint16_t> mine_cells_;          // local_row * 64 + local_column, sorted within each tile
+  std::vector<std::unique_ptr<Tile>> tiles_;  // nullptr until first touched
+  std::vector<size_t> flood_queue_;           // tiles with pending bits
+  int64_t touched_tiles_ = 0;
+  int64_t visited_non_mine_count_ = 0;
+  int64_t marked_correct_mines_count_ = 0;
+};
+
+inline bool LargeGameServer::InBounds(int r, int c) const {
+  return r >= 0 && r < rows_ && c >= 0 && c < columns_;
+}
+
+inline size_t LargeGameServer::TileIndex(int tile_row, int tile_column) const {
+  return static_cast<size_t>(tile_row) * tile_columns_ + tile_column;
+}
+
+inline const LargeGameServer::Tile *LargeGameServer::FindTile(int r, int c) const {
+  return tiles_[TileIndex(r >> kTileBits, c >> kTileBits)].get();
+}
+
+inline LargeGameServer::Tile &LargeGameServer::TouchTile(int tile_row, int tile_column) {
+  std::unique_ptr<Tile> &slot = tiles_[TileIndex(tile_row, tile_column)];
+  if (slot == nullptr) {
+    slot = std::make_unique<Tile>();
+    BuildTile(tile_row, tile_column, *slot);
+    ++touched_tiles_;
+  }
+  return *slot;
+}
+
+/**
+ * Fill the planes of a freshly allocated tile. Adjacency counts come from a 66 x 66 halo of the tile that takes the
+ * border mines of the eight neighbouring tiles into account.
+ */
+inline void LargeGameServer::BuildTile(int tile_row, int tile_column, Tile &tile) const {
+  constexpr int kHalo = kTileSize + 2;
+  uint8_t halo[kHalo][kHalo] = {};
+  for (int dtr = -1; dtr <= 1; ++dtr) {
+    for (int dtc = -1; dtc <= 1; ++dtc) {
+      const int tr = tile_row + dtr, tc = tile_column + dtc;
+      if (tr < 0 || tr >= tile_rows_ || tc < 0 || tc >= tile_columns_) continue;
+      const size_t t = TileIndex(tr, tc);
+      for (uint32_t k = mine_offsets_[t]; k < mine_offsets_[t + 1]; ++k) {
+        const int hr = dtr * kTileSize + (mine_cells_[k] >> kTileBits) + 1;
+        const int hc = dtc * kTileSize + (mine_cells_[k] & (kTileSize - 1)) + 1;
+        if (hr < 0 || hr >= kHalo || hc < 0 || hc >= kHalo) continue;
+        halo[hr][hc] = 1;
+        if (dtr == 0 && dtc == 0) tile.mine_bits[hr - 1] |= uint64_t{1} << (hc - 1);
+      }
+    }
+  }
+  uint8_t column_sums[kHalo];
+  for (int lr = 0; lr < kTileSize; ++lr) {
+    for (int hc = 0; hc < kHalo; ++hc) column_sums[hc] = halo[lr][hc] + halo[lr + 1][hc] + halo[lr + 2][hc];
+    uint64_t zero = 0;
+    for (int lc = 0; lc < kTileSize; ++lc) {
+      const uint8_t count = column_sums[lc] + column_sums[lc + 1] + column_sums[lc + 2] - halo[lr + 1][lc + 1];
+      tile.adjacent_mines[lr * kTileSize + lc] = count;
+      if (count == 0) zero |= uint64_t{1} << lc;
+    }
+    tile.zero_bits[lr] = zero & ~tile.mine_bits[lr];
+  }
+  // Cells beyond the last row or column of the board count as already visited
+  const int valid_rows = std::min(kTileSize, rows_ - tile_row * kTileSize);
+  const int valid_columns = std::min(kTileSize, columns_ - tile_column * kTileSize);
+  const uint64_t outside = valid_columns == kTileSize ? 0 : ~((uint64_t{1} << valid_columns) - 1);
+  for (int lr = 0; lr < kTileSize; ++lr) tile.visited_bits[lr] = lr < valid_rows ? outside : ~uint64_t{0};
+}
+
+inline bool LargeGameServer::IsMine(int r, int c) const {
+  const size_t t = TileIndex(r >> kTileBits, c >> kTileBits);
+  const uint16_t local = static_cast<uint16_t>(((r & (kTileSize - 1)) << kTileBits) | (c & (kTileSize - 1)));
+  return std::binary_search(mine_cells_.begin() + mine_offsets_[t], mine_cells_.begin() + mine_offsets_[t + 1], local);
+}
+
+inline size_t LargeGameServer::memory_bytes() const {
+  return static_cast<size_t>(touched_tiles_) * sizeof(Tile) + tiles_.capacity() * sizeof(tiles_[0]) +
+         mine_offsets_.capacity() * sizeof(uint32_t) + mine_cells_.capacity() * sizeof(uint16_t) +
+         flood_queue_.capacity() * sizeof(size_t);
+}
+
+/**
+ * Start a new game on a rows x columns board with mines at the given cells. Duplicates and cells outside the board are
+ * ignored.
+ */
+inline void LargeGameServer::InitMap(int rows, int columns, const std::vector<std::pair<int, int>> &mines) {
+  rows_ = rows;
+  columns_ = columns;
+  tile_rows_ = (rows + kTileSize - 1) / kTileSize;
+  tile_columns_ = (columns + kTileSize - 1) / kTileSize;
+  game_state_ = 0;
+  touched_tiles_ = 0;
+  visited_non_mine_count_ = 0;
+  marked_correct_mines_count_ = 0;
+  const size_t tile_count = static_cast<size_t>(tile_rows_) * tile_columns_;
+  tiles_.clear();
+  tiles_.resize(tile_count);
+  flood_queue_.clear();
+
+  std::vector<uint64_t> cells;  // row-major cell ids
+  cells.reserve(mines.size());
+  for (const auto &[r, c] : mines) {
+    if (InBounds(r, c)) cells.push_back(static_cast<uint64_t>(r) * columns + c);
+  }
+  std::sort(cells.begin(), cells.end());
+  cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+  total_mines_ = static_cast<int64_t>(cells.size());
+
+  // Counting sort by tile; row-major order within a tile is kept, so every tile list comes out sorted
+  mine_offsets_.assign(tile_count + 1, 0);
+  for (uint64_t cell : cells) {
+    ++mine_offsets_[TileIndex(static_cast<int>(cell / columns) >> kTileBits,
+                              static_cast<int>(cell % columns) >> kTileBits) + 1];
+  }
+  for (size_t t = 0; t < tile_count; ++t) mine_offsets_[t + 1] += mine_offsets_[t];
+  std::vector<uint32_t> next(mine_offsets_.begin(), mine_offsets_.end() - 1);
+  mine_cells_.assign(cells.size(), 0);
+  for (uint64_t cell : cells) {
+    const int r = static_cast<int>(cell / columns), c = static_cast<int>(cell % columns);
+    mine_cells_[next[TileIndex(r >> kTileBits, c >> kTileBits)]++] =
+        static_cast<uint16_t>(((r & (kTileSize - 1)) << kTileBits) | (c & (kTileSize - 1)));
+  }
+}
+
+inline void LargeGameServer::VisitBlock(int r, int c) {
+  if (game_state_ != 0) return;  // game already ended
+  if (!InBounds(r, c)) return;  // invalid operation
+  Tile &tile = TouchTile(r >> kTileBits, c >> kTileBits);
+  const int lr = r & (kTileSize - 1);
+  const uint64_t bit = uint64_t{1} << (c & (kTileSize - 1));
+  if (tile.visited_bits[lr] & bit) return;  // already visited
+  if (tile.marked_bits[lr] & bit) return;  // marked has no effect
+  if (tile.mine_bits[lr] & bit) {
+    // Visiting a mine ends the game immediately
+    tile.visited_bits[lr] |= bit;
+    game_state_ = -1;
+    return;
+  }
+  FloodVisitFrom(r, c);
+}
+
+inline void LargeGameServer::MarkMine(int r, int c) {
+  if (game_state_ != 0) return;  // game already ended
+  if (!InBounds(r, c)) return;  // invalid operation
+  Tile &tile = TouchTile(r >> kTileBits, c >> kTileBits);
+  const int lr = r & (kTileSize - 1);
+  const uint64_t bit = uint64_t{1} << (c & (kTileSize - 1));
+  if (tile.visited_bits[lr] & bit) return;  // already visited -> no effect
+  if (tile.marked_bits[lr] & bit) return;  // already marked -> no effect
+  tile.marked_bits[lr] |= bit;
+  if (tile.mine_bits[lr] & bit) {
+    ++marked_correct_mines_count_;
+  } else {
+    game_state_ = -1;  // marking a non-mine causes immediate failure
+  }
+}
+
+inline void LargeGameServer::AutoExplore(int r, int c) {
+  if (game_state_ != 0) return;
+  if (!InBounds(r, c)) return;
+  const Tile *tile = FindTile(r, c);
+  if (tile == nullptr) return;  // nothing visited there yet
+  const int lr = r & (kTileSize - 1), lc = c & (kTileSize - 1);
+  if (!((tile->visited_bits[lr] >> lc) & 1u) || ((tile->mine_bits[lr] >> lc) & 1u)) return;
+
+  // Count marked neighbors and compare with the number on this cell; untouched tiles hold no marks
+  int marked_neighbors = 0;
+  for (int nr = r - 1; nr <= r + 1; ++nr) {
+    for (int nc = c - 1; nc <= c + 1; ++nc) {
+      if (!InBounds(nr, nc) || (nr == r && nc == c)) continue;
+      const Tile *neighbor = FindTile(nr, nc);
+      if (neighbor != nullptr && ((neighbor->marked_bits[nr & (kTileSize - 1)] >> (nc & (kTileSize - 1))) & 1u)) {
+        ++marked_neighbors;
+      }
+    }
+  }
+  if (marked_neighbors != tile->adjacent_mines[lr * kTileSize + lc]) return;  // not eligible
+
+  // Visit all non-mine neighbors (not marked, not visited)
+  for (int nr = r - 1; nr <= r + 1; ++nr) {
+    for (int nc = c - 1; nc <= c + 1; ++nc) {
+      if (!InBounds(nr, nc)) continue;
+      const Tile &neighbor = TouchTile(nr >> kTileBits, nc >> kTileBits);
+      const uint64_t blocked = neighbor.mine_bits[nr & (kTileSize - 1)] | neighbor.visited_bits[nr & (kTileSize - 1)] |
+                               neighbor.marked_bits[nr & (kTileSize - 1)];
+      if ((blocked >> (nc & (kTileSize - 1))) & 1u) continue;
+      FloodVisitFrom(nr, nc);
+      if (game_state_ != 0) return;  // may win here
+    }
+  }
+}
+
+/**
+ * Render the cells of the given rectangle (clipped to the board), one line per row, in a single write. Untouched tiles
+ * are shown as unknown without being allocated.
+ */
+inline void LargeGameServer::PrintRegion(std::ostream &out, int top, int left, int height, int width) const {
+  const int bottom = std::min(rows_, top + height), right = std::min(columns_, left + width);
+  top = std::max(top, 0);
+  left = std::max(left, 0);
+  std::string frame;
+  if (top < bottom && left < right) frame.reserve(static_cast<size_t>(bottom - top) * (right - left + 1));
+  for (int r = top; r < bottom; ++r) {
+    for (int c = left; c < right; ++c) frame.push_back(RenderedCell(r, c));
+    frame.push_back('\n');
+  }
+  out.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+  out.flush();
+}
+
+/**
+ * Queue the given cells of a tile row for opening. Cells of tiles beyond the board edge are dropped.
+ */
+inline void LargeGameServer::AddPending(int tile_row, int tile_column, int local_row, uint64_t bits) {
+  if (bits == 0 || tile_row < 0 || tile_row >= tile_rows_ || tile_column < 0 || tile_column >= tile_columns_) return;
+  Tile &tile = TouchTile(tile_row, tile_column);
+  tile.pending_bits[local_row] |= bits;
+  if (!tile.queued) {
+    tile.queued = true;
+    flood_queue_.push_back(TileIndex(tile_row, tile_column));
+  }
+}
+
+inline void LargeGameServer::FloodVisitFrom(int r, int c) {
+  AddPending(r >> kTileBits, c >> kTileBits, r & (kTileSize - 1), uint64_t{1} << (c & (kTileSize - 1)));
+  while (!flood_queue_.empty()) {
+    const size_t index = flood_queue_.back();
+    flood_queue_.pop_back();
+    tiles_[index]->queued = false;
+    OpenPendingCells(index);
+  }
+  RecomputeGameWinState();
+}
+
+/**
+ * Open the pending cells of one tile and keep dilating from the zero cells among them until the tile has nothing left
+ * to open. Cells reached across the tile edge become pending in the neighbouring tile.
+ */
+inline void LargeGameServer::OpenPendingCells(size_t index) {
+  const int tile_row = static_cast<int>(index / tile_columns_), tile_column = static_cast<int>(index % tile_columns_);
+  Tile &tile = *tiles_[index];
+  constexpr int kLast = kTileSize - 1;
+  uint64_t front[kTileSize];
+  while (true) {
+    bool has_front = false;
+    for (int lr = 0; lr < kTileSize; ++lr) {
+      const uint64_t grow =
+          tile.pending_bits[lr] & ~tile.mine_bits[lr] & ~tile.visited_bits[lr] & ~tile.marked_bits[lr];
+      tile.pending_bits[lr] = 0;
+      tile.visited_bits[lr] |= grow;
+      visited_non_mine_count_ += __builtin_popcountll(grow);
+      front[lr] = grow & tile.zero_bits[lr];
+      has_front |= front[lr] != 0;
+    }
+    if (!has_front) return;
+    uint64_t west = 0, east = 0;  // rows whose first / last column is in the front
+    for (int lr = 0; lr < kTileSize; ++lr) {
+      const uint64_t x = front[lr];
+      if (x == 0) continue;
+      const uint64_t spread = x | (x << 1) | (x >> 1);
+      if (lr > 0) tile.pending_bits[lr - 1] |= spread;
+      tile.pending_bits[lr] |= spread;
+      if (lr < kLast) tile.pending_bits[lr + 1] |= spread;
+      west |= (x & 1u) << lr;
+      east |= (x >> kLast) << lr;
+    }
+    const uint64_t top = front[0], bottom = front[kLast];
+    AddPending(tile_row - 1, tile_column, kLast, top | (top << 1) | (top >> 1));
+    AddPending(tile_row + 1, tile_column, 0, bottom | (bottom << 1) | (bottom >> 1));
+    AddPending(tile_row - 1, tile_column - 1, kLast, (top & 1u) << kLast);
+    AddPending(tile_row - 1, tile_column + 1, kLast, top >> kLast);
+    AddPending(tile_row + 1, tile_column - 1, 0, (bottom & 1u) << kLast);
+    AddPending(tile_row + 1, tile_column + 1, 0, bottom >> kLast);
+    // A column of the front reaches the neighbouring column rows one above to one below
+    const uint64_t west_rows = west | (west << 1) | (west >> 1), east_rows = east | (east << 1) | (east >> 1);
+    for (uint64_t bits = west_rows; bits != 0; bits &= bits - 1) {
+      AddPending(tile_row, tile_column - 1, __builtin_ctzll(bits), uint64_t{1} << kLast);
+    }
+    for (uint64_t bits = east_rows; bits != 0; bits &= bits - 1) {
+      AddPending(tile_row, tile_column + 1, __builtin_ctzll(bits), 1u);
+    }
+  }
+}
+
+inline void LargeGameServer::RecomputeGameWinState() {
+  const int64_t total_non_mines = static_cast<int64_t>(rows_) * columns_ - total_mines_;
+  if (visited_non_mine_count_ == total_non_mines) game_state_ = 1;
+}
+
+/**
+ * The character PrintMap() of GameServer would show for a cell.
+ */
+inline char LargeGameServer::RenderedCell(int r, int c) const {
+  const Tile *tile = FindTile(r, c);
+  if (tile == nullptr) return game_state_ == 1 && IsMine(r, c) ? '@' : '?';
+  const int lr = r & (kTileSize - 1), lc = c & (kTileSize - 1);
+  const bool mine = (tile->mine_bits[lr] >> lc) & 1u;
+  if (mine && game_state_ == 1) return '@';  // victory reveals all mines
+  if ((tile->marked_bits[lr] >> lc) & 1u) return mine ? '@' : 'X';  // wrong mark appears as X
+  if (!((tile->visited_bits[lr] >> lc) & 1u)) return '?';
+  return mine ? 'X' : static_cast<char>('0' + tile->adjacent_mines[lr * kTileSize + lc]);
+}
+
+#endif
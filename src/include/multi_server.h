@@ -0,0 +1,301 @@
+/**
+ * Building blocks of the session-multiplexed server (see multi.cpp): a lock-free single-producer single-consumer queue
+ * to hand request and response batches between threads, and SessionShard, the games owned by one worker thread.
+ *
+ * Every session belongs to exactly one shard, picked from its id by SessionShardOf(), so a shard's sessions are only
+ * ever touched by its own worker and need no locking. A shard keeps its boards in an arena: GameServers live in a deque
+ * that only grows, and a board whose game has ended goes on a free list and is handed to the next new session, planes
+ * and rendered frame included, so a steady stream of games stops allocating boards once the pool is warm.
+ */
+#ifndef MULTI_SERVER_H
+#define MULTI_SERVER_H
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "generator.h"
+#include "server.h"
+
+constexpr int kMaxSessionBoardSide = 1024;
+
+/**
+ * A bounded ring buffer for one producer thread and one consumer thread. Both ends only touch their own index and read
+ * the other's, so neither takes a lock.
+ */
+template <typename T>
+class SpscQueue {
+ public:
+  explicit SpscQueue(size_t capacity) : slots_(capacity + 1) {}
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue &operator=(const SpscQueue &) = delete;
+
+  /**
+   * Move `value` in. Returns false (and leaves `value` alone) if the queue is full.
+   */
+  bool TryPush(T &value) {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    const size_t next = tail + 1 == slots_.size() ? 0 : tail + 1;
+    if (next == head_.load(std::memory_order_acquire)) return false;
+    slots_[tail] = std::move(value);
+    tail_.store(next, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Move the oldest value out into `value`. Returns false if the queue is empty.
+   */
+  bool TryPop(T &value) {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) return false;
+    value = std::move(slots_[head]);
+    head_.store(head + 1 == slots_.size() ? 0 : head + 1, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  std::vector<T> slots_;
+  alignas(64) std::atomic<size_t> head_{0};
+  alignas(64) std::atomic<size_t> tail_{0};
+};
+
+/**
+ * How a thread waits for a queue: yield for a while, then sleep in short naps so that idle workers leave the cores to
+ * busy ones.
+ */
+class Backoff {
+ public:
+  void Wait() {
+    if (++idle_ < 64) {
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+  }
+  void Reset() { idle_ = 0; }
+
+ private:
+  int idle_ = 0;
+};
+
+inline int SessionShardOf(uint64_t id, int shards) {
+  uint64_t x = id + 0x9e3779b97f4a7c15ull;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return static_cast<int>((x ^ (x >> 31)) % static_cast<uint64_t>(shards));
+}
+
+/**
+ * The sessions of one worker thread. Handle() takes one request line (see multi.cpp for the protocol) and appends the
+ * response to a batch.
+ */
+class SessionShard {
+ public:
+  void Handle(std::string_view line, std::string &out);
+
+  uint64_t sessions_started() const { return sessions_started_; }
+  uint64_t games_finished() const { return games_finished_; }
+  uint64_t operations() const { return operations_; }
+  size_t live_sessions() const { return sessions_.size(); }
+  size_t boards() const { return boards_.size(); }
+
+ private:
+  // Reads the space-separated fields of a request line
+  struct Fields {
+    std::string_view rest;
+
+    std::string_view Next() {
+      const size_t begin = rest.find_first_not_of(" \t\r");
+      if (begin == std::string_view::npos) {
+        rest = {};
+        return {};
+      }
+      const size_t end = std::min(rest.find_first_of(" \t\r", begin), rest.size());
+      const std::string_view field = rest.substr(begin, end - begin);
+      rest.remove_prefix(end);
+      return field;
+    }
+
+    template <typename Integer>
+    bool Next(Integer &value) {
+      const std::string_view field = Next();
+      const auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+      return !field.empty() && error == std::errc() && end == field.data() + field.size();
+    }
+  };
+
+  GameServer &StartSession(uint64_t id);
+  void EndSession(uint64_t id);
+  bool CreateFromMap(GameServer &board, Fields &fields);
+  bool CreateRandom(GameServer &board, Fields &fields);
+  template <typename Integer>
+  static void AppendNumber(std::string &out, Integer value);
+  static void AppendState(std::string &out, uint64_t id, const GameServer &board);
+  static void AppendError(std::string &out, std::string_view id, const char *message);
+
+  std::deque<GameServer> boards_;            // the arena; a deque never moves what it holds
+  std::vector<GameServer *> free_boards_;    // boards of ended games, ready for new sessions
+  std::unordered_map<uint64_t, GameServer *> sessions_;
+  std::vector<uint8_t> mine_scratch_;        // the map of a "map" request
+  std::mt19937_64 engine_;                   // this shard's generator for "random" requests
+  uint64_t sessions_started_ = 0;
+  uint64_t games_finished_ = 0;
+  uint64_t operations_ = 0;
+};
+
+inline GameServer &SessionShard::StartSession(uint64_t id) {
+  EndSession(id);
+  GameServer *board;
+  if (free_boards_.empty()) {
+    board = &boards_.emplace_back();
+  } else {
+    board = free_boards_.back();
+    free_boards_.pop_back();
+  }
+  sessions_.emplace(id, board);
+  ++sessions_started_;
+  return *board;
+}
+
+inline void SessionShard::EndSession(uint64_t id) {
+  const auto found = sessions_.find(id);
+  if (found == sessions_.end()) return;
+  free_boards_.push_back(found->second);
+  sessions_.erase(found);
+}
+
+/**
+ * "map R C row_0 ... row_{R-1}", each row C characters of '.' and 'X' as in InitMap().
+ */
+inline bool SessionShard::CreateFromMap(GameServer &board, Fields &fields) {
+  int rows, columns;
+  if (!fields.Next(rows) || !fields.Next(columns)) return false;
+  if (rows < 1 || rows > kMaxSessionBoardSide || columns < 1 || columns > kMaxSessionBoardSide) return false;
+  mine_scratch_.resize(static_cast<size_t>(rows) * columns);
+  for (int r = 0; r < rows; ++r) {
+    const std::string_view row = fields.Next();
+    if (static_cast<int>(row.size()) != columns) return false;
+    for (int c = 0; c < columns; ++c) mine_scratch_[static_cast<size_t>(r) * columns + c] = row[c] == 'X';
+  }
+  board.InitMap(rows, columns, mine_scratch_.data());
+  return true;
+}
+
+/**
+ * "random R C mines seed min_dist": GenerateMapData() with the shard's engine seeded by `seed`, so a seed gives the
+ * same map on any shard. The server makes the generator's safe first move itself.
+ */
+inline bool SessionShard::CreateRandom(GameServer &board, Fields &fields) {
+  int rows, columns, mines, min_dist;
+  uint64_t seed;
+  if (!fields.Next(rows) || !fields.Next(columns) || !fields.Next(mines) || !fields.Next(seed) ||
+      !fields.Next(min_dist)) {
+    return false;
+  }
+  if (rows < 3 || rows > kMaxSessionBoardSide || columns < 3 || columns > kMaxSessionBoardSide || mines < 0 ||
+      min_dist < 0) {
+    return false;
+  }
+  // Cells within min_dist of the first move, at most a full diamond, are never mines
+  const int64_t reserved = 2 * static_cast<int64_t>(min_dist) * (min_dist + 1) + 1;
+  if (mines > static_cast<int64_t>(rows) * columns - reserved) return false;
+  engine_.seed(seed);
+  const GeneratedMap map = GenerateMapData(rows, columns, mines, min_dist, MineSelection::kCompatible, engine_);
+  board.InitMap(map.rows, map.columns, map.mines.data());
+  board.VisitBlock(map.first_row, map.first_column);
+  return true;
+}
+
+template <typename Integer>
+inline void SessionShard::AppendNumber(std::string &out, Integer value) {
+  char digits[24];
+  const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+  out.append(digits, result.ptr);
+}
+
+/**
+ * "id game_state visits marked" and the board as PrintMap() prints it. `marked` is what ExitGame() prints: all the
+ * mines after a win.
+ */
+inline void SessionShard::AppendState(std::string &out, uint64_t id, const GameServer &board) {
+  AppendNumber(out, id);
+  out += ' ';
+  AppendNumber(out, board.game_state());
+  out += ' ';
+  AppendNumber(out, board.visited_non_mine_count());
+  out += ' ';
+  AppendNumber(out, board.game_state() == 1 ? board.total_mines() : board.marked_correct_mines_count());
+  out += '\n';
+  out.append(board.RenderedMap(), static_cast<size_t>(board.rows()) * (board.columns() + 1));
+}
+
+inline void SessionShard::AppendError(std::string &out, std::string_view id, const char *message) {
+  out.append(id.empty() ? std::string_view("?") : id);
+  out += " error ";
+  out += message;
+  out += '\n';
+}
+
+inline void SessionShard::Handle(std::string_view line, std::string &out) {
+  Fields fields{line};
+  const std::string_view id_field = Fields{line}.Next();
+  uint64_t id;
+  if (!fields.Next(id)) return AppendError(out, id_field, "malformed session id");
+  Fields command = fields;
+  const std::string_view verb = command.Next();
+  if (verb == "map" || verb == "random") {
+    GameServer &board = StartSession(id);
+    if (!(verb == "map" ? CreateFromMap(board, command) : CreateRandom(board, command))) {
+      EndSession(id);
+      return AppendError(out, id_field, "malformed map");
+    }
+  } else if (verb == "end") {
+    EndSession(id);
+    out.append(id_field);
+    out += " closed\n";
+    return;
+  }
+  const auto found = sessions_.find(id);
+  if (found == sessions_.end()) return AppendError(out, id_field, "unknown session");
+  GameServer &board = *found->second;
+  if (verb != "map" && verb != "random") {
+    // "x y type", or "B N" and N such triples, applied as in basic.cpp
+    int count = 1;
+    if (verb == "B") {
+      fields = command;
+      if (!fields.Next(count)) return AppendError(out, id_field, "malformed operation");
+    }
+    for (int i = 0; i < count; ++i) {
+      int x, y, type;
+      if (!fields.Next(x) || !fields.Next(y) || !fields.Next(type)) {
+        return AppendError(out, id_field, "malformed operation");
+      }
+      if (board.game_state() != 0) continue;
+      if (type == 0) {
+        board.VisitBlock(x, y);
+      } else if (type == 1) {
+        board.MarkMine(x, y);
+      } else if (type == 2) {
+        board.AutoExplore(x, y);
+      }
+      ++operations_;
+    }
+  }
+  AppendState(out, id, board);
+  if (board.game_state() != 0) {
+    ++games_finished_;
+    EndSession(id);
+  }
+}
+
+#endif
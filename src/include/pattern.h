@@ -0,0 +1,143 @@
+/**
+ * Local pattern deductions answered by table lookup.
+ *
+ * A pattern is the 5x5 window around an unknown cell. Only the numbers right next to the centre are used as
+ * constraints, since their whole neighbourhoods lie inside the window; each is reduced to the mines it still needs
+ * (its number minus its marked neighbours). Cells are classified as
+ *   kPatternUnknown   an unknown cell covered by at least one of those numbers,
+ *   kPatternInert     anything that is neither a variable nor a constraint (off the board, marked, revealed outside the
+ *                     inner ring, or unknown but covered by no usable number),
+ *   kPatternNumber+k  a number in the inner ring that still needs k mines.
+ * PatternKey() packs a window into 48 bits (4 bits per inner-ring cell, 1 bit per outer-ring cell) and takes the
+ * smallest key over the 8 rotations and reflections. pattern_gen solves the windows met in seeded games exactly and
+ * emits the ones whose centre is forced into pattern_table.h as a perfect hash table, so PatternLookup() costs one
+ * probe. A forced centre is forced in the whole game too, because the window's constraints are a subset of the game's.
+ */
+#ifndef PATTERN_H
+#define PATTERN_H
+
+#include <cstdint>
+
+constexpr int kPatternSize = 5;
+constexpr int kPatternCells = kPatternSize * kPatternSize;
+constexpr int kPatternCentre = kPatternCells / 2;
+
+constexpr uint8_t kPatternUnknown = 0;
+constexpr uint8_t kPatternInert = 1;
+constexpr uint8_t kPatternNumber = 2;
+
+// Table entries: the canonical key, plus whether the slot is used and whether the centre is a mine
+constexpr uint64_t kPatternKeyMask = (uint64_t{1} << 48) - 1;
+constexpr uint64_t kPatternUsed = uint64_t{1} << 62;
+constexpr uint64_t kPatternMine = uint64_t{1} << 63;
+
+namespace pattern_detail {
+
+constexpr int Row(int i) { return i / kPatternSize; }
+constexpr int Column(int i) { return i % kPatternSize; }
+constexpr bool Inner(int i) {
+  return Row(i) >= 1 && Row(i) <= 3 && Column(i) >= 1 && Column(i) <= 3 && i != kPatternCentre;
+}
+constexpr bool Adjacent(int i, int j) {
+  return i != j && Row(i) - Row(j) <= 1 && Row(j) - Row(i) <= 1 && Column(i) - Column(j) <= 1 &&
+         Column(j) - Column(i) <= 1;
+}
+
+// Window cell that lands on cell i under symmetry t
+constexpr int Transform(int t, int i) {
+  const int r = Row(i), c = Column(i), n = kPatternSize - 1;
+  const int rows[8] = {r, c, n - r, n - c, r, n - r, c, n - c};
+  const int columns[8] = {c, n - r, n - c, r, n - c, c, r, n - r};
+  return rows[t] * kPatternSize + columns[t];
+}
+
+// The geometry above as lookup tables, so that the runtime path does no arithmetic on positions
+struct Tables {
+  uint32_t neighbors[kPatternCells] = {};  // bit j set if cell j is next to cell i
+  uint32_t inner = 0;                      // bits of the inner ring
+  uint8_t inner_order[8][8] = {};          // window cells read for key bits 4k..4k+3 under symmetry t
+  uint8_t outer_order[8][16] = {};         // window cells read for key bit 32+k under symmetry t
+};
+
+constexpr Tables MakeTables() {
+  Tables tables;
+  for (int i = 0; i < kPatternCells; ++i) {
+    for (int j = 0; j < kPatternCells; ++j) {
+      if (Adjacent(i, j)) tables.neighbors[i] |= uint32_t{1} << j;
+    }
+    if (Inner(i)) tables.inner |= uint32_t{1} << i;
+  }
+  for (int t = 0; t < 8; ++t) {
+    int inner = 0, outer = 0;
+    for (int i = 0; i < kPatternCells; ++i) {
+      if (i == kPatternCentre) continue;
+      if (Inner(i)) {
+        tables.inner_order[t][inner++] = static_cast<uint8_t>(Transform(t, i));
+      } else {
+        tables.outer_order[t][outer++] = static_cast<uint8_t>(Transform(t, i));
+      }
+    }
+  }
+  return tables;
+}
+
+constexpr Tables kTables = MakeTables();
+
+}  // namespace pattern_detail
+
+inline uint64_t PatternHash(uint64_t key, uint64_t seed) {
+  uint64_t x = key ^ (seed * 0x9e3779b97f4a7c15ull);
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+/**
+ * Drop the unknown cells no inner-ring number covers, which cannot affect the centre, so that equivalent windows share
+ * a key. `window` holds kPatternCells codes in row-major order, with an unknown centre. Returns false if the window has
+ * no number to deduce from.
+ */
+inline bool NormalizePattern(uint8_t *window) {
+  const pattern_detail::Tables &tables = pattern_detail::kTables;
+  uint32_t numbers = 0;
+  for (int i = 0; i < kPatternCells; ++i) numbers |= static_cast<uint32_t>(window[i] >= kPatternNumber) << i;
+  numbers &= tables.inner;
+  if (numbers == 0) return false;
+  for (int i = 0; i < kPatternCells; ++i) {
+    if (window[i] == kPatternUnknown && i != kPatternCentre && (tables.neighbors[i] & numbers) == 0) {
+      window[i] = kPatternInert;
+    }
+  }
+  return true;
+}
+
+/**
+ * The canonical key of a normalized window.
+ */
+inline uint64_t PatternKey(const uint8_t *window) {
+  const pattern_detail::Tables &tables = pattern_detail::kTables;
+  uint64_t best = ~uint64_t{0};
+  for (int t = 0; t < 8; ++t) {
+    uint64_t key = 0;
+    for (int k = 0; k < 8; ++k) key |= static_cast<uint64_t>(window[tables.inner_order[t][k]]) << (4 * k);
+    for (int k = 0; k < 16; ++k) {
+      key |= static_cast<uint64_t>(window[tables.outer_order[t][k]] == kPatternUnknown) << (32 + k);
+    }
+    if (key < best) best = key;
+  }
+  return best;
+}
+
+#include "pattern_table.h"
+
+/**
+ * Look a canonical key up. Returns 1 if the centre is a mine, 0 if it is safe and -1 if the table does not know.
+ */
+inline int PatternLookup(uint64_t key) {
+  const uint64_t bucket = PatternHash(key, 0) % kPatternBuckets;
+  const uint64_t entry = kPatternEntries[PatternHash(key, kPatternSeeds[bucket]) % kPatternSlots];
+  if ((entry & ~kPatternMine) != (key | kPatternUsed)) return -1;
+  return (entry & kPatternMine) != 0 ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,788 @@
+// Generated by pattern_gen 500 2; do not edit. See pattern.h.
+#ifndef PATTERN_TABLE_H
+#define PATTERN_TABLE_H
+
+#include <cstdint>
+
+constexpr uint64_t kPatternBuckets = 589;
+constexpr uint64_t kPatternSlots = 2946;
+constexpr uint16_t kPatternSeeds[] = {
+    4, 1, 7, 10, 2, 2, 20, 6, 2, 2, 0, 6, 0, 39, 6, 20,
+    5, 3, 19, 9, 1, 1, 7, 6, 15, 6, 0, 28, 3, 9, 5, 3,
+    1, 11, 7, 14, 1, 2, 3, 24, 2, 1, 37, 2, 4, 19, 14, 2,
+    2, 2, 1, 1, 8, 1, 26, 18, 1, 6, 4, 28, 11, 3, 15, 1,
+    4, 10, 7, 41, 20, 1, 1, 2, 5, 7, 8, 3, 29, 4, 58, 13,
+    21, 11, 1, 5, 23, 7, 7, 12, 17, 8, 1, 37, 1, 3, 13, 2,
+    16, 46, 32, 7, 3, 23, 10, 2, 14, 1, 17, 1, 2, 4, 28, 3,
+    5, 1, 32, 5, 3, 9, 32, 19, 22, 8, 28, 16, 1, 4, 5, 27,
+    9, 1, 6, 3, 2, 6, 12, 13, 8, 3, 5, 38, 9, 8, 7, 9,
+    1, 4, 66, 3, 2, 12, 4, 13, 8, 17, 2, 1, 10, 6, 7, 2,
+    2, 9, 16, 8, 17, 3, 3, 16, 23, 14, 6, 3, 28, 8, 7, 1,
+    4, 61, 1, 20, 2, 1, 37, 14, 1, 1, 2, 1, 18, 13, 3, 30,
+    38, 1, 5, 23, 32, 3, 16, 1, 46, 1, 28, 10, 4, 3, 7, 27,
+    4, 5, 5, 21, 9, 2, 4, 6, 18, 2, 14, 20, 3, 1, 4, 2,
+    4, 9, 6, 1, 3, 6, 10, 3, 6, 1, 24, 11, 4, 4, 1, 6,
+    2, 1, 1, 5, 11, 1, 24, 10, 38, 9, 2, 13, 68, 10, 33, 8,
+    20, 7, 5, 2, 1, 3, 8, 26, 33, 3, 55, 1, 1, 17, 3, 2,
+    11, 26, 42, 8, 58, 32, 35, 18, 1, 4, 1, 7, 8, 3, 4, 6,
+    26, 18, 0, 104, 6, 13, 22, 18, 14, 41, 28, 24, 1, 26, 3, 5,
+    1, 2, 24, 1, 79, 18, 6, 5, 1, 4, 2, 9, 27, 8, 4, 4,
+    2, 4, 6, 66, 20, 10, 6, 45, 21, 4, 1, 6, 6, 10, 11, 1,
+    2, 2, 11, 3, 14, 15, 1, 13, 55, 6, 2, 34, 14, 32, 5, 3,
+    3, 0, 35, 1, 12, 1, 25, 9, 39, 47, 0, 7, 1, 8, 60, 53,
+    13, 8, 7, 6, 16, 16, 9, 1, 4, 11, 4, 9, 19, 15, 18, 14,
+    11, 8, 22, 1, 4, 22, 15, 5, 5, 11, 35, 1, 2, 29, 2, 6,
+    18, 42, 9, 41, 4, 18, 17, 16, 6, 51, 12, 4, 8, 84, 5, 56,
+    28, 10, 12, 16, 13, 13, 2, 1, 56, 5, 1, 15, 2, 1, 2, 7,
+    23, 4, 29, 37, 33, 5, 69, 80, 54, 67, 21, 26, 15, 6, 44, 2,
+    4, 14, 8, 4, 7, 13, 1, 82, 6, 39, 0, 1, 5, 13, 4, 3,
+    28, 14, 33, 7, 3, 42, 53, 19, 58, 3, 1, 24, 22, 3, 9, 2,
+    16, 2, 21, 149, 83, 2, 43, 33, 14, 5, 3, 3, 23, 2, 23, 1,
+    12, 7, 40, 3, 16, 5, 8, 12, 2, 9, 5, 25, 0, 5, 3, 30,
+    58, 1, 9, 78, 4, 8, 16, 61, 1, 28, 21, 16, 3, 3, 12, 4,
+    24, 9, 1, 29, 16, 5, 4, 60, 6, 74, 41, 9, 23, 1, 4, 44,
+    21, 16, 12, 47, 1, 29, 1, 1, 13, 4, 10, 1, 4, 40, 84, 5,
+    13, 1, 5, 9, 2, 4, 7, 5, 131, 5, 101, 17, 6, 4, 3, 1,
+    15, 25, 15, 4, 16, 66, 6, 61, 3, 1, 42, 6, 68,
+};
+constexpr uint64_t kPatternEntries[] = {
+    0x0ull, 0xc000000413330404ull, 0xc00002c830033033ull, 0x0ull,
+    0x4000018010300343ull, 0xc000000233300340ull, 0xc000000210400330ull, 0x0ull,
+    0x0ull, 0x400000a610013134ull, 0x400001a033103400ull, 0xc00003a013500434ull,
+    0x0ull, 0x4000000313103404ull, 0xc000002440103500ull, 0xc000030243400440ull,
+    0x4000000414300301ull, 0x0ull, 0xc00001a043400435ull, 0xc000038443500601ull,
+    0xc000018443400105ull, 0x4000038434300501ull, 0x0ull, 0x4000008c34300601ull,
+    0xc00000a630130405ull, 0x0ull, 0xc000018004100434ull, 0x0ull,
+    0x4000008403340301ull, 0xc000000313130303ull, 0x4000000403140301ull, 0x4000000530344304ull,
+    0xc000021c30034404ull, 0xc000018013400414ull, 0x0ull, 0x0ull,
+    0x4000000400354300ull, 0x4000000003143101ull, 0x4000023f30340403ull, 0xc000008813330033ull,
+    0x4000000430400103ull, 0xc000000010303403ull, 0xc000038443500104ull, 0x400001a130400133ull,
+    0xc000008711313133ull, 0xc000000613330103ull, 0x4000002330440305ull, 0x4000002f10304033ull,
+    0xc000000000331303ull, 0xc000000630013150ull, 0xc000008c33400301ull, 0x4000000300344304ull,
+    0x4000000200130043ull, 0x4000000204330140ull, 0x0ull, 0xc00000c031400434ull,
+    0x0ull, 0x4000000404033103ull, 0x0ull, 0x400001a434300104ull,
+    0x0ull, 0xc00003a113500435ull, 0x4000008830440043ull, 0x0ull,
+    0xc000008633400440ull, 0x400000e830344433ull, 0x0ull, 0xc000008831400444ull,
+    0xc000018443400104ull, 0xc000000400333401ull, 0x4000038e34300040ull, 0x40000b8234300360ull,
+    0x400001a134300115ull, 0xc000118843000044ull, 0x4000008813330053ull, 0xc000000203133304ull,
+    0xc000000404103404ull, 0x4000018414300301ull, 0x4000000403101403ull, 0x0ull,
+    0x4000021030530333ull, 0xc000008411310303ull, 0x4000089c30440301ull, 0x400000bb11100343ull,
+    0xc000000211100333ull, 0xc000018004400434ull, 0xc000000214040003ull, 0x4000018234300140ull,
+    0x400001a034300144ull, 0xc000000011310303ull, 0x4000018634300450ull, 0x0ull,
+    0x0ull, 0x0ull, 0x4000002734100103ull, 0x4000000730354003ull,
+    0x400000e134300344ull, 0xc000000613310330ull, 0x0ull, 0xc000008404440405ull,
+    0x4000008830110343ull, 0x400000c430440003ull, 0x4000000233103403ull, 0x4000002e30344030ull,
+    0x4000000003141301ull, 0x0ull, 0xc000000630333150ull, 0xc000000430313400ull,
+    0x4000000213110305ull, 0x4000001f10344304ull, 0x400001e134300444ull, 0xc000000010333301ull,
+    0x4000000f30344304ull, 0x4000008834100063ull, 0x4000030434300105ull, 0x4000002400356300ull,
+    0x0ull, 0x4000000214300340ull, 0x4000000630314103ull, 0x4000000330304305ull,
+    0x400000c035000443ull, 0x4000000003143301ull, 0xc000000e30333444ull, 0xc00000c433400501ull,
+    0x4000028f33303063ull, 0x0ull, 0xc00000a730130405ull, 0xc000008f04303063ull,
+    0xc000000230343004ull, 0x400001a031100343ull, 0xc000000000331301ull, 0x400000b134300445ull,
+    0xc000078453500105ull, 0x4000000600344103ull, 0x0ull, 0x4000002410314113ull,
+    0x400000e030150033ull, 0xc000000233300350ull, 0x0ull, 0xc000018011100434ull,
+    0x4000000003143303ull, 0x0ull, 0x4000000130344304ull, 0x4000008811330053ull,
+    0xc000000210303150ull, 0x400000c430540004ull, 0x0ull, 0x400000c034100343ull,
+    0xc000000233101333ull, 0x400002dc03340301ull, 0x4000002c30346300ull, 0x4000000231300360ull,
+    0x0ull, 0x4000000000350301ull, 0x4000000730344303ull, 0x4000008411130043ull,
+    0x400000c030430003ull, 0x400002c030065003ull, 0x4000000510314103ull, 0x0ull,
+    0x0ull, 0x4000020c30045301ull, 0xc000000411330404ull, 0xc000000f30333504ull,
+    0x4000008410013134ull, 0x400001f134300343ull, 0x4000000730140303ull, 0xc000000730333106ull,
+    0x4000003c10345300ull, 0x4000068400033340ull, 0x0ull, 0xc000000611310330ull,
+    0x0ull, 0xc000000630133405ull, 0xc00000d033400334ull, 0x0ull,
+    0x4000000413103504ull, 0x0ull, 0x0ull, 0x400000d034100343ull,
+    0xc00000d030400434ull, 0x4000000204044304ull, 0x4000008a11100354ull, 0xc000000614100440ull,
+    0x0ull, 0x4000000130410134ull, 0x0ull, 0x400001e311100343ull,
+    0x4000008834300041ull, 0x4000000730341304ull, 0x4000021c11334403ull, 0x400000dc34300601ull,
+    0x4000008810130343ull, 0xc000009c30330601ull, 0x0ull, 0x400002c034400343ull,
+    0x400000f130140334ull, 0x4000000413330105ull, 0xc000002400333400ull, 0xc000030434004404ull,
+    0x0ull, 0x0ull, 0x4000000610314103ull, 0x4000000410314303ull,
+    0xc000000230330144ull, 0xc000000633300440ull, 0xc000000430313104ull, 0xc000020800035041ull,
+    0xc000000410303501ull, 0x4000028c30340301ull, 0x0ull, 0xc000008403440401ull,
+    0xc00001a743400104ull, 0xc000000400343401ull, 0x4000018031300343ull, 0x400000c010130043ull,
+    0x0ull, 0x400000d030140334ull, 0x0ull, 0xc000000f13330403ull,
+    0xc00001a003400434ull, 0xc00001a110404335ull, 0x4000008c30440404ull, 0x4000000230314303ull,
+    0x4000000e10304030ull, 0x4000000110344304ull, 0x4000000603004103ull, 0x4000009c30140403ull,
+    0xc000068633430330ull, 0xc000018010500431ull, 0x0ull, 0x4000000600330305ull,
+    0x0ull, 0x4000000400345300ull, 0xc000000700333405ull, 0x0ull,
+    0xc000018443400505ull, 0xc00000e033400435ull, 0x4000000140301333ull, 0xc000008430414405ull,
+    0x4000002734300104ull, 0x400001a211100343ull, 0xc000008411430104ull, 0x0ull,
+    0x400001f311100343ull, 0xc000000613033104ull, 0xc000000430333104ull, 0x400000e134300443ull,
+    0xc00000c030450005ull, 0x400000c034300343ull, 0x0ull, 0x0ull,
+    0xc000018043400505ull, 0xc00000c033400401ull, 0x0ull, 0x40007dfb03533334ull,
+    0x4000000e13330305ull, 0x4000000410305300ull, 0x4000008630530130ull, 0x4000000f30130343ull,
+    0xc000000411100444ull, 0x4000000430430133ull, 0x4000000330144304ull, 0xc0000b0433404404ull,
+    0x400001a011300343ull, 0x0ull, 0x400000b130100443ull, 0x40000ba113530307ull,
+    0xc000008403330303ull, 0x0ull, 0xc000002410335400ull, 0xc000000010330131ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x4000008c30340301ull, 0x0ull, 0xc000000210313104ull, 0x4000000400351303ull,
+    0x400000c010340301ull, 0x0ull, 0x0ull, 0x4000030210003343ull,
+    0x4000000004340304ull, 0xc000000400343104ull, 0x400001a005300344ull, 0x0ull,
+    0xc00000e033400334ull, 0x400000a811100343ull, 0x400001a034100313ull, 0x400003d410003334ull,
+    0xc000000233300040ull, 0x4000000613310305ull, 0xc000034404034004ull, 0xc000000610303444ull,
+    0x0ull, 0xc00001a103400435ull, 0x4000018005300341ull, 0x4000008413130305ull,
+    0xc000020c30033504ull, 0x4000000400354303ull, 0x4000000130314103ull, 0x400001b611103334ull,
+    0xc000028c30430501ull, 0x4000038634300450ull, 0x0ull, 0xc000000230301340ull,
+    0x400001a411130434ull, 0xc000068433330401ull, 0x4000000130343033ull, 0x4000000613034104ull,
+    0x4000000210344304ull, 0x4000000513330055ull, 0x400002af10003035ull, 0x0ull,
+    0x0ull, 0xc000000213330103ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4000000030344303ull, 0xc000008611410330ull, 0xc00000c011440034ull,
+    0x4000130433003403ull, 0x4000021c30045301ull, 0xc000008410410404ull, 0xc000018005400504ull,
+    0x4000000f30344403ull, 0xc000000613130030ull, 0x4000008810130053ull, 0x0ull,
+    0xc000098443500104ull, 0x4000000730144304ull, 0x400000c430430003ull, 0x4000000230410130ull,
+    0xc000002230333303ull, 0x400001a131300344ull, 0x400000c030430013ull, 0x4000002610314113ull,
+    0xc000009030530401ull, 0x4000024013330043ull, 0x400000d830130343ull, 0x400000dc30440301ull,
+    0x4000000434300303ull, 0x4000000413300304ull, 0xc000009830130434ull, 0x0ull,
+    0x400001a104300344ull, 0x4000038310003343ull, 0x4000009014300343ull, 0x4000000234300350ull,
+    0xc000000733300104ull, 0x4000000634003103ull, 0xc000002830334400ull, 0x400001ab11100343ull,
+    0xc000008805000444ull, 0xc00001e111100536ull, 0x4000008830140033ull, 0x4000008613310360ull,
+    0x4000089c04330401ull, 0x0ull, 0x4000000210430130ull, 0x0ull,
+    0xc00001a143400434ull, 0x4000000330304103ull, 0x4000008840100453ull, 0x4000118433000403ull,
+    0x4000000210304304ull, 0x4000008c04330301ull, 0x0ull, 0x4000008411113304ull,
+    0x0ull, 0x4000009830140403ull, 0x0ull, 0x40000a9c30440301ull,
+    0x0ull, 0x4000009011330404ull, 0xc00001a141100436ull, 0x4000030434003103ull,
+    0x0ull, 0xc000008711313144ull, 0x4000000000130043ull, 0x4000021c30045403ull,
+    0x4000000130344303ull, 0xc000002711114404ull, 0xc000002f13330403ull, 0x0ull,
+    0x400000ae10003034ull, 0x400000b134300443ull, 0x40000b8434400303ull, 0xc000018010400434ull,
+    0x400000f030140335ull, 0x4000018214300360ull, 0xc000000330333304ull, 0xc000008633400340ull,
+    0x4000002613014103ull, 0x400000c030540334ull, 0x400000c030140314ull, 0x4000000740304405ull,
+    0x0ull, 0xc000018013400431ull, 0xc000008633400106ull, 0x0ull,
+    0x4000030834400053ull, 0x0ull, 0x4000008403340304ull, 0x4000009034300401ull,
+    0x4000000210303343ull, 0x4000000234300343ull, 0x4000000613330106ull, 0xc000000611330103ull,
+    0x400007a500033434ull, 0x4000000730314103ull, 0xc000030850500031ull, 0xc000008430530401ull,
+    0xc000000413310331ull, 0xc000008430330401ull, 0x400000c030440013ull, 0x0ull,
+    0x0ull, 0xc000000210430105ull, 0xc000008430130405ull, 0x4000002c40304300ull,
+    0x0ull, 0xc000000633101304ull, 0xc000000a13330403ull, 0xc00003d043400434ull,
+    0x40000ba134300344ull, 0x4000008811110343ull, 0x4000003630335330ull, 0x0ull,
+    0x400001a004300343ull, 0xc00003a143500135ull, 0xc00000c030130333ull, 0x4000002413005104ull,
+    0x4000008614300340ull, 0x4000000000334130ull, 0x400007a500034436ull, 0x4000002430345300ull,
+    0x40000b0443303503ull, 0xc00001a141400435ull, 0x4000000234300341ull, 0x0ull,
+    0x4000018311100343ull, 0x4000000634300304ull, 0x4000000200354304ull, 0x4000008c34300501ull,
+    0xc000000410313401ull, 0x0ull, 0x0ull, 0x0ull,
+    0xc000030431303104ull, 0x0ull, 0x0ull, 0x4000000731100403ull,
+    0xc000002e13104030ull, 0x4000021403340301ull, 0x40000b8434300401ull, 0x4000002813103503ull,
+    0x4000009c30340301ull, 0x4000000230144003ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x0ull, 0x0ull,
+    0x0ull, 0xc000018243400450ull, 0xc000000011330303ull, 0xc000009c13430404ull,
+    0x400001a114300343ull, 0x0ull, 0x4000000240303331ull, 0x4000002430410103ull,
+    0xc000002630333150ull, 0x0ull, 0x0ull, 0x400000af10303035ull,
+    0x0ull, 0x4000000303143304ull, 0x4000021830045403ull, 0x0ull,
+    0x0ull, 0xc000000233100344ull, 0xc000018011400431ull, 0x4000020830003503ull,
+    0x4000000735000103ull, 0x4000008e34300450ull, 0x40000b8834300053ull, 0xc000002430335400ull,
+    0x0ull, 0x4000038403340301ull, 0x400007f700033335ull, 0x0ull,
+    0x4000002713014103ull, 0x0ull, 0xc00001a111400435ull, 0x4000018434300103ull,
+    0x400000e011100343ull, 0x4000000140303333ull, 0xc000021830034403ull, 0xc00000c033400434ull,
+    0xc000002713310404ull, 0x400000e134300444ull, 0xc0000b0433403104ull, 0x4000008830430143ull,
+    0x400000c434300501ull, 0x0ull, 0x4000000410314103ull, 0xc000000400333104ull,
+    0xc000020c30034504ull, 0x0ull, 0x0ull, 0x4000018414300404ull,
+    0xc000000600333404ull, 0x0ull, 0x0ull, 0x4000000713310306ull,
+    0x4000009c10430303ull, 0xc000000610303505ull, 0x4000018231300360ull, 0x400000fb11100343ull,
+    0x40000af134400443ull, 0x400002c033304503ull, 0x4000000213330305ull, 0xc000009811430404ull,
+    0x4000000310303343ull, 0x4000000434300114ull, 0x4000000634300105ull, 0x4000002240304340ull,
+    0x4000000003330304ull, 0x4000000710304303ull, 0x400000f034300444ull, 0xc000002c33104030ull,
+    0x4000000000345300ull, 0x4000021c30045303ull, 0xc000003130330333ull, 0x4000000210004343ull,
+    0x400000c830530034ull, 0x0ull, 0xc000018210500430ull, 0xc000006111300433ull,
+    0x4000008800130343ull, 0xc000000410430401ull, 0xc000000414100304ull, 0x4000002430345301ull,
+    0x0ull, 0x0ull, 0xc000002733300104ull, 0x400003d034400343ull,
+    0x0ull, 0x0ull, 0x4000000204340054ull, 0xc000008410430405ull,
+    0x0ull, 0x400001e311100354ull, 0x400001a834300044ull, 0xc000000203330140ull,
+    0x4000000730114305ull, 0x4000008410340301ull, 0x4000000233103150ull, 0x0ull,
+    0x4000000610003343ull, 0xc000008833400034ull, 0xc000001f13330503ull, 0x4000025004330333ull,
+    0xc000029c30430601ull, 0x4000020830045303ull, 0xc000000003133303ull, 0x0ull,
+    0xc000000e13103030ull, 0x4000000003141031ull, 0x4000000740301303ull, 0x0ull,
+    0x4000008430441301ull, 0xc000090234400344ull, 0x4000000633103504ull, 0x4000000630114103ull,
+    0xc000000600343404ull, 0xc000000211300330ull, 0xc000018243400130ull, 0x4000000330314304ull,
+    0x400003a510003435ull, 0x400001a110300344ull, 0x400001a134300143ull, 0xc000000630333404ull,
+    0xc000008810430144ull, 0xc000000213300340ull, 0x4000008634300450ull, 0x0ull,
+    0xc000029010500434ull, 0xc00001a150100436ull, 0x4000000310344304ull, 0x400001a111100343ull,
+    0x0ull, 0xc000021c30035504ull, 0xc000000410331404ull, 0x0ull,
+    0x4000000230314130ull, 0x4000000733103403ull, 0x4000000000353031ull, 0x4000000300354304ull,
+    0xc000000203300340ull, 0x400000cc34300601ull, 0x0ull, 0xc000000010331103ull,
+    0x400000d031100443ull, 0xc000008430130106ull, 0x0ull, 0x40000b8434300501ull,
+    0x4000000633103403ull, 0xc000018241400430ull, 0x0ull, 0xc000000600343405ull,
+    0x4000035034400343ull, 0x400000c011100343ull, 0x0ull, 0x4000008830440404ull,
+    0xc000025c30013404ull, 0x4000008430140304ull, 0x40000a9c30540301ull, 0x4000002400354300ull,
+    0xc000009c11430304ull, 0x4000000713034103ull, 0x0ull, 0x4000001f13330507ull,
+    0x4000002710315104ull, 0x4000008813330404ull, 0xc000000003130133ull, 0x0ull,
+    0x4000018014300343ull, 0x0ull, 0x4000035040003311ull, 0x4000000213103350ull,
+    0x400001a135000343ull, 0x4000000000351301ull, 0xc000009c13330503ull, 0x4000000003143103ull,
+    0x4000000330344303ull, 0x4000008c05300301ull, 0x4000030440003503ull, 0x4000000234100343ull,
+    0x0ull, 0x0ull, 0x0ull, 0x4000008403330304ull,
+    0xc000000730113405ull, 0x4000000140103333ull, 0x400000c830440033ull, 0x4000009c10340301ull,
+    0xc000000230313104ull, 0x0ull, 0xc000008833400051ull, 0xc00000c013400431ull,
+    0xc0000b8443600601ull, 0x4000018004300304ull, 0x4000008630404103ull, 0x400000cc34300501ull,
+    0x4000068443300403ull, 0x400001a500130433ull, 0x4000000210103343ull, 0xc000000633300105ull,
+    0x0ull, 0x4000008c10003034ull, 0xc00000ce11440030ull, 0x4000000e34300050ull,
+    0x4000002e11103034ull, 0x4000000630351003ull, 0x4000000430314301ull, 0x400000c030100443ull,
+    0x4000002610314103ull, 0x4000000f30341305ull, 0x400001a034003100ull, 0x4000008830044033ull,
+    0x4000000010341303ull, 0x400000e130140333ull, 0xc00000a833400055ull, 0x0ull,
+    0x0ull, 0x400000dc30340301ull, 0x4000002c30345300ull, 0x4000008834300453ull,
+    0x4000008634300460ull, 0x0ull, 0x4000000f30344303ull, 0x0ull,
+    0x0ull, 0x0ull, 0xc000002230333140ull, 0xc000000e13310330ull,
+    0x0ull, 0x4000008c00350301ull, 0x4000000400355300ull, 0xc000008413130404ull,
+    0x4000000633101454ull, 0x400000d030140333ull, 0x4000018430400103ull, 0x4000000710314304ull,
+    0x4000018014100343ull, 0xc000130443005104ull, 0x4000084430444003ull, 0x4000008411334104ull,
+    0xc000000010313301ull, 0xc000000310303305ull, 0x4000000713103504ull, 0xc000002713310303ull,
+    0xc000000610313405ull, 0x4000000730144103ull, 0x4000008413330405ull, 0x4000018004300341ull,
+    0xc00003c043400434ull, 0x0ull, 0x4000003e30335330ull, 0x4000008830035333ull,
+    0x4000008413330304ull, 0x0ull, 0x4000000430314303ull, 0xc000008411330404ull,
+    0x4000009030100443ull, 0xc000032143400433ull, 0x4000018611100343ull, 0x400000e030140334ull,
+    0x4000000630400103ull, 0x400000c810130053ull, 0xc00000c830130054ull, 0x0ull,
+    0xc000018043400434ull, 0x0ull, 0x400000dc10340301ull, 0x4000000400344301ull,
+    0x0ull, 0x4000000630334130ull, 0x4000000130430134ull, 0x4000008400330304ull,
+    0x0ull, 0xc000008833100054ull, 0x0ull, 0xc000008430430115ull,
+    0xc000008811100444ull, 0x0ull, 0x4000035034400443ull, 0x0ull,
+    0x0ull, 0xc000000610333405ull, 0x0ull, 0xc000030443400104ull,
+    0x0ull, 0x0ull, 0xc000038843400044ull, 0x400007a500034434ull,
+    0x4000000613103504ull, 0xc000008411311404ull, 0x0ull, 0xc000000630133404ull,
+    0xc000008c30130505ull, 0x4000000704330304ull, 0xc000000313101334ull, 0x4000000634300404ull,
+    0xc0000b0443404403ull, 0xc00003e033045005ull, 0x0ull, 0xc00001a043400135ull,
+    0x4000000f30314305ull, 0x4000000211100354ull, 0x0ull, 0x4000018205300350ull,
+    0xc000000700343404ull, 0x0ull, 0x400000c030450003ull, 0x4000001f00354403ull,
+    0x4000002310304344ull, 0x4000009c13430406ull, 0x400003a830600044ull, 0x4000000700354305ull,
+    0x40000bd034400443ull, 0xc000008411310404ull, 0x4000001f30344305ull, 0x4000009811100343ull,
+    0x4000000230100143ull, 0xc000000f33103304ull, 0x0ull, 0x4000000730341303ull,
+    0x0ull, 0x4000000403144300ull, 0xc000000730333405ull, 0x4000000410440304ull,
+    0x0ull, 0xc000000300333304ull, 0x0ull, 0xc000000630303105ull,
+    0x0ull, 0x400001e111100343ull, 0x4000008613130306ull, 0x4000000410345300ull,
+    0x4000008c34300401ull, 0x4000024030056003ull, 0x400001f134300344ull, 0xc00002c430440501ull,
+    0x0ull, 0x0ull, 0xc00000e011100435ull, 0x4000118433004103ull,
+    0x400002c430350401ull, 0xc000008c30130504ull, 0x0ull, 0x400001a634300104ull,
+    0x4000000413330304ull, 0x4000000405300301ull, 0xc000000e10303444ull, 0xc000002313130303ull,
+    0x0ull, 0xc000000010331303ull, 0x0ull, 0x4000008634300103ull,
+    0x4000000211330305ull, 0xc000000240100344ull, 0x0ull, 0xc000009811330503ull,
+    0x4000000410344301ull, 0x4000006730134003ull, 0x0ull, 0x4000035034300343ull,
+    0xc00000c830340043ull, 0xc000000430430401ull, 0x4000000000430133ull, 0xc000000613310404ull,
+    0xc000000000133031ull, 0x0ull, 0xc000000613110330ull, 0xc000000f30333505ull,
+    0x4000018011300304ull, 0xc000008411410405ull, 0x0ull, 0x4000000240300341ull,
+    0x4000002c30344300ull, 0x4000000010310304ull, 0x0ull, 0xc000000410303504ull,
+    0xc000000630330160ull, 0xc000008833400041ull, 0x400003a500033434ull, 0xc000021c30034504ull,
+    0x4000008611314406ull, 0x40000bd031500343ull, 0x4000000140304403ull, 0x4000000413101443ull,
+    0x0ull, 0x0ull, 0x4000078244300340ull, 0x0ull,
+    0x0ull, 0xc000035043004511ull, 0xc000000000333031ull, 0x40000b0413304403ull,
+    0xc00000a811100335ull, 0x4000000010344303ull, 0x4000000403143301ull, 0xc000008430430401ull,
+    0xc000008c33400401ull, 0x4000008800140343ull, 0x4000000230100343ull, 0x40000b8234300340ull,
+    0x4000000413310304ull, 0x0ull, 0x400001e011100343ull, 0x4000001b13330406ull,
+    0xc000000233300140ull, 0xc000009811330403ull, 0xc000008c33100034ull, 0x4000008e11303034ull,
+    0x4000008c11300034ull, 0x0ull, 0x4000000633101403ull, 0xc000000413103301ull,
+    0x0ull, 0x400001eb11100354ull, 0x400003d010400343ull, 0xc000008411330103ull,
+    0x0ull, 0xc000030443303104ull, 0xc000000233300130ull, 0xc00000c830430044ull,
+    0x0ull, 0x40000b8234300350ull, 0xc000000230133140ull, 0xc00001a111100436ull,
+    0x4000000403143303ull, 0xc000000000333301ull, 0x4000000613130305ull, 0x4000000634300150ull,
+    0xc000018411100545ull, 0xc00000ce13340030ull, 0xc000000633300340ull, 0x4000000013330304ull,
+    0xc000000230304404ull, 0x4000000330344305ull, 0x4000028c40300301ull, 0x4000000600354304ull,
+    0x0ull, 0x4000018634300040ull, 0x4000000213330060ull, 0x4000001f30344304ull,
+    0xc000000413310330ull, 0xc000008811110334ull, 0x4000006110304433ull, 0xc000000710333405ull,
+    0x4000030440006403ull, 0x0ull, 0x0ull, 0x4000003830345300ull,
+    0xc00000a730130404ull, 0x400001ad34300055ull, 0x4000009c34300701ull, 0x0ull,
+    0x0ull, 0x4000000730344304ull, 0x4000000340303343ull, 0x400001a011100343ull,
+    0x0ull, 0x0ull, 0x400001a130140033ull, 0x4000018111100343ull,
+    0x400000ac30344300ull, 0xc000008830130334ull, 0x4000018011300341ull, 0xc000030434004033ull,
+    0x400001a034100343ull, 0x4000008411113334ull, 0x0ull, 0x4000000130354003ull,
+    0x4000000600344303ull, 0x0ull, 0xc000000231300330ull, 0x0ull,
+    0x4000008834300153ull, 0x0ull, 0x400000d011100343ull, 0x4000002413103500ull,
+    0xc000000410333400ull, 0x400001e911100343ull, 0x4000000613110305ull, 0x0ull,
+    0x0ull, 0x400001e311133035ull, 0xc00000c813340033ull, 0xc000000f13103304ull,
+    0xc00001a044000435ull, 0x400001a140100343ull, 0x4000018214300350ull, 0x0ull,
+    0xc000000330333105ull, 0xc00000a711410405ull, 0xc000018004400431ull, 0x4000002430044300ull,
+    0xc000000230100344ull, 0x4000038434300103ull, 0x0ull, 0xc000000403133404ull,
+    0x4000018234300340ull, 0x0ull, 0x4000000310304304ull, 0x400002b131300444ull,
+    0x4000000700354304ull, 0x4000000610344304ull, 0x4000000030440304ull, 0x400000c011330004ull,
+    0x400001a010300344ull, 0x0ull, 0x4000009030430333ull, 0x0ull,
+    0xc00001a141400434ull, 0x400002e434003400ull, 0x0ull, 0x4000000205003341ull,
+    0x40000bd031300343ull, 0x4000002410316300ull, 0x400001e034300444ull, 0x400000dc34300701ull,
+    0x400000c030440003ull, 0x0ull, 0x4000000010300304ull, 0x0ull,
+    0x40000b8834400053ull, 0x4000038834400053ull, 0x0ull, 0x0ull,
+    0x4000000403004103ull, 0x0ull, 0x4000000430334130ull, 0xc0000b9e31530360ull,
+    0x4000000200130054ull, 0x40000b8414300301ull, 0x4000000110314304ull, 0x4000000410304403ull,
+    0xc000000213300350ull, 0x40000adc30340301ull, 0xc000008833400050ull, 0x4000000414300303ull,
+    0x4000008813000343ull, 0x400001a030400133ull, 0xc000030441005504ull, 0x40000b8405300301ull,
+    0x0ull, 0x400002c010304403ull, 0x4000000613034405ull, 0x400002d034400443ull,
+    0x4000000010344301ull, 0x0ull, 0x4000000214100354ull, 0x400001a035000313ull,
+    0x400000b111100343ull, 0x0ull, 0x4000008611334105ull, 0x4000006630344003ull,
+    0x0ull, 0x4000018004100343ull, 0xc000000003340101ull, 0x0ull,
+    0xc000000733103305ull, 0x4000000733103505ull, 0x4000018205300340ull, 0x4000018010400343ull,
+    0x4000081c30444403ull, 0xc000038243500430ull, 0x4000000010430131ull, 0x4000068433340301ull,
+    0x4000024031400443ull, 0x0ull, 0x400000c430460004ull, 0x0ull,
+    0x400001a004300344ull, 0x4000000f33101503ull, 0x400001a034300114ull, 0x400001a311100354ull,
+    0x0ull, 0x0ull, 0x400001e134300344ull, 0x4000000334003343ull,
+    0x4000009813130505ull, 0x4000000400354003ull, 0x4000000734003104ull, 0x4000018005000343ull,
+    0xc000000410333104ull, 0x4000000405300404ull, 0x4000000630114303ull, 0xc000009c33400501ull,
+    0xc000000430313401ull, 0x0ull, 0x4000000000344303ull, 0x4000000230341304ull,
+    0x400000c011330043ull, 0x0ull, 0x400007a500034435ull, 0xc00000f130130434ull,
+    0xc0000b8843500034ull, 0x0ull, 0x0ull, 0x4000018211100343ull,
+    0xc00003c043400534ull, 0x4000000430344103ull, 0xc000000400353004ull, 0xc00000c830440054ull,
+    0x0ull, 0x400001f130400333ull, 0x4000000430345300ull, 0xc00001a113400434ull,
+    0x400003a111300345ull, 0x4000000010304403ull, 0x0ull, 0x4000009c30540301ull,
+    0x4000035a10003343ull, 0x4000000610334130ull, 0x0ull, 0x4000000403103504ull,
+    0x4000008634300104ull, 0x4000000100344303ull, 0xc000018203400430ull, 0x400001a304000343ull,
+    0x4000002733101403ull, 0xc00001a043100435ull, 0xc000000f10303555ull, 0x400001a105300343ull,
+    0xc000018204400430ull, 0xc000000730130405ull, 0xc000000230333140ull, 0xc000000633103440ull,
+    0x0ull, 0x400001b011100343ull, 0xc000000230313304ull, 0x0ull,
+    0xc000000730313106ull, 0x4000008411113134ull, 0x400000e130150405ull, 0x4000018434300105ull,
+    0x4000025410333533ull, 0x4000000631100403ull, 0x4000008404340304ull, 0xc000000231103330ull,
+    0x40000c0743303403ull, 0xc000000630034405ull, 0x0ull, 0x0ull,
+    0x4000008c10300034ull, 0x4000025c30046403ull, 0xc000000733103304ull, 0xc000018011400434ull,
+    0xc00000c010400434ull, 0x4000002430346300ull, 0x400000aa11100354ull, 0x0ull,
+    0x400001e130100443ull, 0x400000aa11100343ull, 0x4000218930130434ull, 0x0ull,
+    0x4000000340303344ull, 0xc000000310313305ull, 0x4000003c30344300ull, 0xc000008410414105ull,
+    0x0ull, 0x40000bd010400343ull, 0x4000024030046303ull, 0x4000000734300105ull,
+    0x0ull, 0x4000002710314113ull, 0x4000000610314304ull, 0x0ull,
+    0x4000008813430405ull, 0x4000002730334103ull, 0x4000002310314103ull, 0xc000000733103303ull,
+    0xc000000610303504ull, 0x4000008830140304ull, 0x4000096840464033ull, 0x0ull,
+    0x4000000330343033ull, 0x400000c830440043ull, 0xc0000b8843400034ull, 0xc000000730313405ull,
+    0x4000000434300104ull, 0x4000000610300355ull, 0x4000009014100343ull, 0x4000000240301340ull,
+    0x4000018211100354ull, 0x4000000713014103ull, 0xc000000000150033ull, 0x0ull,
+    0x4000018410300304ull, 0xc000000000340133ull, 0xc000018003400411ull, 0xc000000731103303ull,
+    0xc0000f8450450501ull, 0x4000068400033334ull, 0x0ull, 0xc00001a143100436ull,
+    0x400002e134400443ull, 0xc000000630131404ull, 0x400000c030440301ull, 0x4000018005300350ull,
+    0xc000000330333303ull, 0x4000000430430003ull, 0x0ull, 0xc000008830430314ull,
+    0x4000000700353033ull, 0xc000009011100434ull, 0xc000000110333104ull, 0x0ull,
+    0x4000002730344303ull, 0xc000008704303143ull, 0xc000000710303504ull, 0xc00000d030130433ull,
+    0x0ull, 0x4000008811310343ull, 0x0ull, 0x0ull,
+    0x40000bd034300443ull, 0x4000008c04330401ull, 0x4000000340301343ull, 0xc000090243400140ull,
+    0x400003c034400443ull, 0xc000000f10303506ull, 0xc000008613310330ull, 0x4000000410354003ull,
+    0x4000090430404103ull, 0x4000002240303330ull, 0x4000002403144300ull, 0x4000000214300350ull,
+    0x4000000e10303343ull, 0x0ull, 0x4000000634100103ull, 0xc000002711330103ull,
+    0x0ull, 0x400001a114300314ull, 0xc000009813110434ull, 0xc000000010313103ull,
+    0x400000f134300544ull, 0x4000024430445003ull, 0x4000006730344003ull, 0x0ull,
+    0xc000018013100434ull, 0xc000000410333004ull, 0x0ull, 0x4000000411330304ull,
+    0x4000000230314103ull, 0x4000000434300404ull, 0x4000006334100443ull, 0x4000068440450301ull,
+    0x4000038834300043ull, 0x0ull, 0x400000ac30445300ull, 0x0ull,
+    0x400000e034300443ull, 0x0ull, 0x4000029c30440301ull, 0x4000008830410033ull,
+    0x4000000240303343ull, 0x0ull, 0x0ull, 0xc000000413310313ull,
+    0x4000002410344300ull, 0x400001eb11100343ull, 0x4000000733101403ull, 0x0ull,
+    0x4000000333101343ull, 0x4000000011310304ull, 0xc000030843300043ull, 0xc000000633103303ull,
+    0x400000f134300444ull, 0x400000d830141313ull, 0x4000008830430343ull, 0x0ull,
+    0xc00001a041400434ull, 0xc000020c33303033ull, 0x4000000730114304ull, 0x400001a131100343ull,
+    0xc0000b0433303303ull, 0x4000000010430133ull, 0xc000000600333105ull, 0x4000018005100343ull,
+    0x4000002403143300ull, 0x0ull, 0x400000c811100343ull, 0x4000008804330301ull,
+    0xc000008631400440ull, 0x4000000403143103ull, 0xc000000730034404ull, 0x4000002e10305030ull,
+    0x0ull, 0xc000000000440303ull, 0x0ull, 0xc000000000334300ull,
+    0xc00000dc33400501ull, 0x0ull, 0x0ull, 0x4000009034100443ull,
+    0xc000002630334405ull, 0x400001e511103435ull, 0x40000af834300344ull, 0xc00001a643400105ull,
+    0x400000c030364003ull, 0xc000000130313104ull, 0xc00000d013100534ull, 0x400000ab11100343ull,
+    0x0ull, 0x0ull, 0x40000b0434400103ull, 0x4000000200344304ull,
+    0x4000130434004403ull, 0x4000000434300505ull, 0x4000000210304303ull, 0x0ull,
+    0x4000000011330304ull, 0x4000000f10304403ull, 0x0ull, 0xc000006013340403ull,
+    0x0ull, 0x4000084430454003ull, 0x4000002730344304ull, 0xc000000640303105ull,
+    0x400002bc30044300ull, 0xc000000413330103ull, 0xc000006111100435ull, 0x0ull,
+    0x4000008430540301ull, 0xc000021c30033504ull, 0xc000190743403105ull, 0x4000000403103403ull,
+    0xc00000c030430334ull, 0x0ull, 0xc000000000343303ull, 0x4000009813310341ull,
+    0xc00001a110500435ull, 0x4000008830440304ull, 0x4000000730114303ull, 0x4000006730450003ull,
+    0xc000002430333400ull, 0xc00000f031100435ull, 0x400001a134100143ull, 0x4000000010314301ull,
+    0x4000000a10304030ull, 0xc000020c30034404ull, 0x0ull, 0x0ull,
+    0x40000e8433430305ull, 0x4000021830045503ull, 0x0ull, 0xc000000310313105ull,
+    0xc000000513103405ull, 0xc000001f13103303ull, 0x4000018034300343ull, 0x4000002433103500ull,
+    0xc000000430303104ull, 0xc000003f33104305ull, 0x4000000205300350ull, 0x400000c030440333ull,
+    0x4000009030140303ull, 0xc000002400335400ull, 0x400001b111100343ull, 0x4000003c30346300ull,
+    0x4000020830045403ull, 0xc000018041400434ull, 0xc000130444005504ull, 0x0ull,
+    0xc000002210314105ull, 0xc000000410331401ull, 0xc000002430305500ull, 0x4000000234100354ull,
+    0xc0000b0843400033ull, 0x4000000333103404ull, 0xc0000b8444600405ull, 0xc00000f033400435ull,
+    0x400000c030150033ull, 0x400007a500033433ull, 0xc000000233103303ull, 0x4000002413330406ull,
+    0xc0000f0443403104ull, 0x40000b0433304103ull, 0xc000009c13330303ull, 0xc000009a11410430ull,
+    0xc000000700343405ull, 0x400003a031300344ull, 0x0ull, 0x400000c830150033ull,
+    0x4000000630141303ull, 0x4000000311100354ull, 0x4000000410340301ull, 0x4000000530114304ull,
+    0x400002dc03440301ull, 0x4000000240400354ull, 0xc000008613110404ull, 0x0ull,
+    0x4000000310314304ull, 0x4000006730354003ull, 0x400001f104300344ull, 0x4000000001330304ull,
+    0x0ull, 0xc000000403340401ull, 0x4000000400350301ull, 0x400001a134300104ull,
+    0x0ull, 0x4000002810304033ull, 0x40000e8433440301ull, 0xc000018211400430ull,
+    0x0ull, 0x4000008f10303035ull, 0xc000000614010330ull, 0x4000008834100043ull,
+    0x0ull, 0xc000000411310404ull, 0x4000018014300313ull, 0x0ull,
+    0x0ull, 0xc000000b33103304ull, 0x400000c030440043ull, 0x4000002411113334ull,
+    0x40000e8433340301ull, 0xc000018243400140ull, 0x0ull, 0xc000000630130406ull,
+    0x0ull, 0xc000009c11430404ull, 0x0ull, 0xc000018213400440ull,
+    0x0ull, 0x4000008411430305ull, 0x4000008430340303ull, 0x4000008410113134ull,
+    0xc000008810130334ull, 0x400000a911100453ull, 0x4000000240100343ull, 0xc000000411330303ull,
+    0x4000018403300304ull, 0x4000000240303341ull, 0x4000000030300343ull, 0x4000008430440301ull,
+    0x4000008830140403ull, 0x0ull, 0x4000009c13110406ull, 0x4000081830344403ull,
+    0x4000008810330404ull, 0xc000030444003104ull, 0xc00001e211100546ull, 0xc000000730303405ull,
+    0x0ull, 0x400000e111100343ull, 0x4000000610314130ull, 0x40000b8c34300041ull,
+    0x400001a105300344ull, 0x0ull, 0x400000e130150406ull, 0xc000002f10303056ull,
+    0xc000000211101333ull, 0x0ull, 0x4000000703143303ull, 0x4000000613010360ull,
+    0xc000002230133140ull, 0x4000000413101403ull, 0x4000030433005103ull, 0xc000000234000344ull,
+    0x0ull, 0x0ull, 0x4000000404340405ull, 0x4000009830430303ull,
+    0x4000018214300340ull, 0x4000000e30333343ull, 0xc00000c130140404ull, 0x4000008634300350ull,
+    0x4000000730141304ull, 0x400000d830140314ull, 0xc000000630333405ull, 0x4000002410345301ull,
+    0x4000018006000343ull, 0x4000000340304403ull, 0x4000000210344303ull, 0xc000008c30130445ull,
+    0x400001a010400343ull, 0x400001a014100343ull, 0x4000009c34300301ull, 0x400001a034300113ull,
+    0xc000008833000044ull, 0xc000008830130403ull, 0x400001e034300344ull, 0xc00006a133500335ull,
+    0xc000002730334405ull, 0x4000018411300304ull, 0x4000018234300350ull, 0x4000020c10304403ull,
+    0x0ull, 0xc000000400343400ull, 0x4000008e11314030ull, 0xc000001313330403ull,
+    0x4000090410304303ull, 0x4000000411113340ull, 0x0ull, 0x4000000410344300ull,
+    0x4000002430146300ull, 0x0ull, 0xc00000bf11410605ull, 0x4000000630341304ull,
+    0x4000000411310405ull, 0xc000008413130303ull, 0x4000000234300354ull, 0xc0000b8443600401ull,
+    0x400000c011130043ull, 0xc00001a443400104ull, 0xc000000630113404ull, 0xc00001a104400435ull,
+    0xc000018003400414ull, 0x0ull, 0x400000c830430043ull, 0x4000000430304303ull,
+    0xc00000dc33400401ull, 0xc000008613410330ull, 0xc000008703313133ull, 0x400001a014300343ull,
+    0x400001a014300313ull, 0x4000000311101343ull, 0x4000000010341103ull, 0x0ull,
+    0xc000006030344004ull, 0xc00000d033400431ull, 0x0ull, 0x4000002e10304053ull,
+    0x0ull, 0x4000018004300343ull, 0x4000002410345300ull, 0x0ull,
+    0x4000028c30440301ull, 0x4000008c30440301ull, 0x4000030610003343ull, 0xc00001a050500435ull,
+    0xc000009c13430304ull, 0x0ull, 0x0ull, 0x4000000710344103ull,
+    0x0ull, 0x400000e030150405ull, 0x4000002710304403ull, 0x0ull,
+    0x4000008611313134ull, 0x4000000731103504ull, 0x4000130433004403ull, 0x4000006130140334ull,
+    0xc000018443400106ull, 0x0ull, 0xc000000030333303ull, 0x0ull,
+    0x0ull, 0x4000008c11310304ull, 0x0ull, 0x4000008834300063ull,
+    0x4000000411310304ull, 0x4000000635000103ull, 0x0ull, 0x4000000e10303453ull,
+    0x400001a134100343ull, 0x0ull, 0x0ull, 0xc000000610333404ull,
+    0x4000008834300401ull, 0x0ull, 0x0ull, 0x4000008400333334ull,
+    0x0ull, 0x400002c034400443ull, 0x4000008430440304ull, 0x4000000610303343ull,
+    0x0ull, 0x4000084430354003ull, 0x4000029810400343ull, 0x0ull,
+    0x4000018013300304ull, 0xc00001e143400434ull, 0xc000000611113330ull, 0x40000b0834400063ull,
+    0x4000000130314303ull, 0x400007a600033430ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0xc00000fc11343400ull, 0x4000030434300103ull,
+    0x0ull, 0xc000002430134400ull, 0x0ull, 0xc000000711310404ull,
+    0x4000018e34300040ull, 0x4000000240304340ull, 0x400000c004330001ull, 0xc00000d030130434ull,
+    0x4000030431304103ull, 0x4000018434300104ull, 0xc000000410334400ull, 0xc000008830110334ull,
+    0x4000009834300443ull, 0x4000020830445040ull, 0x4000000713004103ull, 0x4000000430344303ull,
+    0x4000000f30314304ull, 0x4000000310344305ull, 0x0ull, 0x0ull,
+    0x4000008411130054ull, 0xc000021033300333ull, 0xc000018413400601ull, 0x0ull,
+    0x4000002440303300ull, 0xc000008611430304ull, 0x4000000130344103ull, 0x0ull,
+    0x4000000234300150ull, 0x40000be334300505ull, 0xc000000210301333ull, 0x4000008c14300301ull,
+    0x0ull, 0x0ull, 0x0ull, 0xc00000c013450004ull,
+    0x0ull, 0x0ull, 0x4000008c11303034ull, 0xc0000b8843500044ull,
+    0xc000008834000034ull, 0x0ull, 0x4000000710304403ull, 0x4000030441004503ull,
+    0x4000002230335130ull, 0x400001a114100343ull, 0x4000002410315104ull, 0x4000000330341304ull,
+    0xc000008c30530501ull, 0x0ull, 0x0ull, 0x0ull,
+    0xc000000610313105ull, 0xc000020c33400033ull, 0xc000002511113333ull, 0xc000029c13430403ull,
+    0xc000001f30333545ull, 0x4000000710341304ull, 0x4000000630344304ull, 0x4000002730344003ull,
+    0x4000002730334003ull, 0x4000009013330404ull, 0x0ull, 0xc000009c30530601ull,
+    0x4000021c30144303ull, 0x4000008834300050ull, 0x4000028c03340301ull, 0x4000090434300104ull,
+    0xc000008430340105ull, 0x400000d834300443ull, 0x0ull, 0xc000000233103330ull,
+    0xc00000e111100436ull, 0x0ull, 0x4000038c34300043ull, 0x400000d031300443ull,
+    0x4000000210300354ull, 0xc000001b13330403ull, 0x4000008430340301ull, 0x4000008410003034ull,
+    0x4000008411330405ull, 0x4000030430004504ull, 0x0ull, 0x0ull,
+    0x0ull, 0x4000000234003340ull, 0xc000008401340404ull, 0x0ull,
+    0xc00000c830440044ull, 0x40000e8433540301ull, 0x400001a134300345ull, 0xc000118443000106ull,
+    0x400002b033304333ull, 0x0ull, 0x0ull, 0x4000000740304103ull,
+    0x400000c013330004ull, 0x4000000300354303ull, 0xc00001a143400435ull, 0xc000024430035004ull,
+    0x0ull, 0xc00000c033100334ull, 0xc000030444005504ull, 0xc000002230303340ull,
+    0xc000000413330303ull, 0x4000090430304103ull, 0x4000002713005104ull, 0x0ull,
+    0xc00001f143400535ull, 0x4000002434300105ull, 0x4000008430100403ull, 0x4000009404330301ull,
+    0x4000000213330105ull, 0x4000000610344003ull, 0x4000000411310344ull, 0xc00001e110500534ull,
+    0x4000000410341301ull, 0x400003a210003334ull, 0x4000000413100304ull, 0xc000018010404304ull,
+    0x4000000234300351ull, 0x4000000410340303ull, 0x0ull, 0xc000000713310303ull,
+    0xc000002440303500ull, 0x400001a134300343ull, 0x0ull, 0x400001a014300344ull,
+    0xc000002e04104130ull, 0xc000000413310303ull, 0x4000000404033003ull, 0x4000000730314303ull,
+    0x0ull, 0xc00000c013340033ull, 0x4000000200430130ull, 0x0ull,
+    0xc000008840100034ull, 0xc000008833400044ull, 0x4000030430500103ull, 0x4000008811100343ull,
+    0x0ull, 0xc000008c34000034ull, 0xc000008400550304ull, 0x4000018635000103ull,
+    0x4000008440300301ull, 0x0ull, 0x4000030434400103ull, 0x400000c030140313ull,
+    0xc00000d030330433ull, 0xc000008830440405ull, 0x4000002431103500ull, 0x0ull,
+    0xc000000413300404ull, 0xc000008c33400501ull, 0x400006e200043334ull, 0xc000000113330303ull,
+    0xc000001f13330403ull, 0x4000008c11113304ull, 0xc00008ce13440030ull, 0x0ull,
+    0xc00001a011100435ull, 0xc000008413130103ull, 0x4000008c30341301ull, 0x400000c811130053ull,
+    0x0ull, 0xc000000211100344ull, 0x400001e134300343ull, 0x400000aa11100453ull,
+    0x400000e130140313ull, 0x0ull, 0x0ull, 0x400001fb11100343ull,
+    0x0ull, 0x0ull, 0xc000008c30430501ull, 0x4000008813410344ull,
+    0xc000130443005504ull, 0xc000000710333404ull, 0xc00000c030130334ull, 0x4000002430316300ull,
+    0x4000009830430343ull, 0x4000000233103060ull, 0xc00001a050100435ull, 0x4000000340101343ull,
+    0x4000000210003343ull, 0x400000c813430054ull, 0x4000000211100343ull, 0x4000021813430404ull,
+    0x400000af10003035ull, 0x400000cc00350301ull, 0x4000018205300360ull, 0x0ull,
+    0x4000008611100343ull, 0x40000b8434400103ull, 0xc000008430130404ull, 0xc00000c011400434ull,
+    0x0ull, 0x4000000233103404ull, 0x0ull, 0xc000021c30434404ull,
+    0x4000000630035130ull, 0x40000f8434300401ull, 0x400000c030340301ull, 0x400000c830450033ull,
+    0x4000008430140303ull, 0x4000000334300343ull, 0x4000000f30140305ull, 0x0ull,
+    0x4000000310103343ull, 0x4000018003300304ull, 0x4000000404340304ull, 0xc000000010300333ull,
+    0xc000018211100445ull, 0x0ull, 0x4000002600345304ull, 0x40000b8834500053ull,
+    0xc000002730130404ull, 0x4000130443004604ull, 0x0ull, 0xc0000b0843400043ull,
+    0x4000000240003340ull, 0x4000008830430333ull, 0x4000000234300360ull, 0x4000008430410103ull,
+    0xc000018003400440ull, 0x400000d034300343ull, 0xc000000403131404ull, 0x4000000210334130ull,
+    0x0ull, 0xc00000a713330404ull, 0x0ull, 0x0ull,
+    0x0ull, 0x0ull, 0x4000089c03340301ull, 0xc000000210333140ull,
+    0x4000090634400103ull, 0xc000000410313104ull, 0xc0000b0431403104ull, 0x4000035030540333ull,
+    0x0ull, 0xc000030433303104ull, 0x4000000234300050ull, 0x400000dc34300401ull,
+    0xc000000633300103ull, 0x4000002810305030ull, 0x4000001f10304503ull, 0x4000002e10304033ull,
+    0xc000000230130304ull, 0xc000018111100435ull, 0x4000008c34300301ull, 0xc000008411333400ull,
+    0x4000008831100063ull, 0x4000000734300104ull, 0x4000008430150003ull, 0x4000238c40054403ull,
+    0xc000000413310404ull, 0xc00000e031100435ull, 0x0ull, 0xc000020f11333406ull,
+    0x4000000413300314ull, 0x4000009010430313ull, 0x4000009031300343ull, 0x4000021030045403ull,
+    0x4000002430344300ull, 0x4000000230140103ull, 0xc00001a040100435ull, 0xc00000bf13130403ull,
+    0x400000c013330043ull, 0x4000018010300341ull, 0x4000000430315300ull, 0x0ull,
+    0x0ull, 0x0ull, 0x4000000734003103ull, 0x4000002210314103ull,
+    0x4000008430140103ull, 0x4000002634300105ull, 0xc000002400343400ull, 0x0ull,
+    0x400001a511103435ull, 0x4000038410003304ull, 0x0ull, 0x400000c013430044ull,
+    0x0ull, 0x4000002410314103ull, 0xc000000400343004ull, 0x4000008c10340301ull,
+    0x400000c013330050ull, 0xc000000213130303ull, 0xc000000330331304ull, 0x4000000730344305ull,
+    0x4000000f30341403ull, 0xc00000c013400434ull, 0xc00000f033100435ull, 0x4000018005300343ull,
+    0x4000030834400043ull, 0xc000000710303445ull, 0xc000000630331404ull, 0x4000000700354303ull,
+    0x400003d034400443ull, 0x0ull, 0x4000000413310344ull, 0x0ull,
+    0xc000002313330303ull, 0x4000018234300360ull, 0xc000000633300104ull, 0x400000b011100343ull,
+    0x0ull, 0xc000000400331404ull, 0x400001a114300313ull, 0x4000008e34300050ull,
+    0x400001f134300444ull, 0x4000000534100103ull, 0x4000030433304103ull, 0xc0000e8433330401ull,
+    0x0ull, 0x4000000233101403ull, 0x4000002510314103ull, 0xc00000be33105330ull,
+    0x0ull, 0x4000000403143300ull, 0x0ull, 0x0ull,
+    0x4000000240304404ull, 0x400000b034300444ull, 0x4000000210400354ull, 0x400003d050300431ull,
+    0x0ull, 0x4000000710344304ull, 0x4000000010300341ull, 0x4000000710344303ull,
+    0x4000006130440334ull, 0xc00000b811333400ull, 0x0ull, 0xc000018003400434ull,
+    0x4000000330354003ull, 0xc000000630130404ull, 0x4000000410304301ull, 0x0ull,
+    0x0ull, 0x0ull, 0xc000030843400033ull, 0xc000000230313140ull,
+    0xc000000000343301ull, 0x400000c413330005ull, 0xc000008833100044ull, 0x0ull,
+    0x4000000230344303ull, 0x4000000604330340ull, 0xc000000403133303ull, 0xc000000204300330ull,
+    0xc000008833400054ull, 0x4000000234300103ull, 0xc000000710303505ull, 0x4000009011100343ull,
+    0x4000008813430054ull, 0x4000000230140304ull, 0x40000b0443304103ull, 0x4000000400340405ull,
+    0xc000000233300054ull, 0xc000000003130113ull, 0x4000000600344304ull, 0x4000009e30530330ull,
+    0xc000008410530401ull, 0x0ull, 0x0ull, 0xc000000730133405ull,
+    0x0ull, 0x4000021c30045503ull, 0x400000c030140334ull, 0x0ull,
+    0x0ull, 0xc000000404101404ull, 0x0ull, 0x4000009034100343ull,
+    0x0ull, 0x4000002f10304443ull, 0x4000000410330304ull, 0xc000008830130404ull,
+    0x4000000630430130ull, 0x0ull, 0xc00000a711113333ull, 0x0ull,
+    0x4000000630344303ull, 0x4000000630141304ull, 0x4000000403141303ull, 0xc000008401430405ull,
+    0x4000009c34300501ull, 0x0ull, 0x4000000000450304ull, 0xc000000410313404ull,
+    0x4000000210314130ull, 0xc00000d033400434ull, 0xc000002410333400ull, 0x4000000613330305ull,
+    0xc000000400334400ull, 0x4000000234300340ull, 0xc00000dc33400601ull, 0x4000000410344303ull,
+    0x4000000010430113ull, 0x4000000630140030ull, 0x400001a034300343ull, 0x0ull,
+    0x400003b610003334ull, 0x4000018240300330ull, 0x4000000634300103ull, 0xc000000730313406ull,
+    0x0ull, 0xc000130433004303ull, 0xc000006111300434ull, 0xc000008413430405ull,
+    0x4000000210314103ull, 0xc000000411310303ull, 0xc000190743403104ull, 0x4000000610314303ull,
+    0xc000000730131405ull, 0x40001adc30340301ull, 0x4000021c11334504ull, 0x4000000713330407ull,
+    0xc000000633300450ull, 0x0ull, 0x0ull, 0x4000008430350003ull,
+    0x4000002c10344300ull, 0x400001a134300313ull, 0x4000000603143304ull, 0x0ull,
+    0xc000000230333303ull, 0x4000000430430103ull, 0xc000024430034004ull, 0x4000000330140305ull,
+    0x4000002f10304043ull, 0x4000008634300050ull, 0x4000000713101504ull, 0x4000021810334403ull,
+    0x4000090433303504ull, 0xc00001a010400435ull, 0x4000002e10103034ull, 0x0ull,
+    0xc000000400331401ull, 0x0ull, 0x0ull, 0xc000038843500054ull,
+    0x4000008f11303035ull, 0x0ull, 0x4000000110314103ull, 0xc000000413101313ull,
+    0x400000c830540054ull, 0x4000018005300313ull, 0x0ull, 0x400003a031304333ull,
+    0xc000000610333105ull, 0x4000021f33303343ull, 0x4000000410344103ull, 0xc00001a043400105ull,
+    0x4000029c30340301ull, 0xc000000713310334ull, 0x40000b0834400053ull, 0xc000000713310404ull,
+    0x4000000430344003ull, 0xc000000233103304ull, 0x4000000410314301ull, 0x4000030430405103ull,
+    0x4000008711313335ull, 0x4000006730365004ull, 0x400003a310003335ull, 0x0ull,
+    0x40000ad034300443ull, 0x4000000233103350ull, 0x4000009c34300401ull, 0x4000000734100103ull,
+    0x4000029804400343ull, 0x0ull, 0x400001a511133434ull, 0x4000000234000343ull,
+    0x4000008410330304ull, 0x4000000331103404ull, 0xc000000614300440ull, 0x0ull,
+    0x4000000613103403ull, 0xc000028c30033404ull, 0xc00001a113400435ull, 0xc000000210303304ull,
+    0x4000002430144300ull, 0xc00000c031400334ull, 0xc000000010313303ull, 0xc000030444004504ull,
+    0xc000008c30330501ull, 0x0ull, 0x400001a130100343ull, 0x4000001f30344303ull,
+    0xc000000630430406ull, 0x0ull, 0xc00001f111100636ull, 0xc000009033400434ull,
+    0x400001aa11100343ull, 0x4000000000344301ull, 0x400001a111300343ull, 0xc000002811100334ull,
+    0x4000000534003103ull, 0xc000000a13330044ull, 0x4000038434300404ull, 0x4000118636000103ull,
+    0xc00001a013400434ull, 0xc000000213130030ull, 0x0ull, 0x4000000400344003ull,
+    0x400002e330044334ull, 0xc000018203400440ull, 0xc00003a150600434ull, 0xc000000330313304ull,
+    0xc0000b8443500505ull, 0x4000003c30045300ull, 0x4000031010003340ull, 0x0ull,
+    0x4000000411300304ull, 0x400003a510003335ull, 0xc00000f030130433ull, 0xc000000433300103ull,
+    0x4000008430430103ull, 0xc000000013330303ull, 0x4000008c11330405ull, 0x4000030433303403ull,
+    0x400000a711113335ull, 0x4000000604330140ull, 0x400000e130140335ull, 0xc00000a711114334ull,
+    0xc000020c10404404ull, 0xc000000210303333ull, 0x40000ad034400443ull, 0x400001eb00140534ull,
+    0xc000000010303401ull, 0x0ull, 0xc000029c30033504ull, 0x4000218410300304ull,
+    0x4000009c11330505ull, 0x0ull, 0x4000000410341103ull, 0xc00003a143500434ull,
+    0xc000000310303334ull, 0x4000008400130054ull, 0xc000002430334400ull, 0x0ull,
+    0x4000035810003340ull, 0x0ull, 0x4000000130341304ull, 0x0ull,
+    0x400003a500034435ull, 0x0ull, 0x4000000010344103ull, 0xc000000313310303ull,
+    0xc00001a743400105ull, 0x0ull, 0x0ull, 0x4000018405300303ull,
+    0x0ull, 0xc000009c30440606ull, 0x400001a031300344ull, 0x0ull,
+    0xc00000ac33106300ull, 0xc000000713330404ull, 0x4000030433003403ull, 0x4000000100344304ull,
+    0x4000020c30045403ull, 0x4000018f31313035ull, 0x0ull, 0x0ull,
+    0xc000000433300105ull, 0x4000018011300343ull, 0xc000003b13330403ull, 0x4000008410310304ull,
+    0xc000000210004333ull, 0x400000c034300450ull, 0xc000000003131301ull, 0xc00001e143400435ull,
+    0xc000000233300330ull, 0x4000000430440104ull, 0xc00000d033100434ull, 0x4000008430151003ull,
+    0x4000000430440301ull, 0xc000000730130406ull, 0x4000008813010343ull, 0xc000002713330103ull,
+    0x4000008c11330505ull, 0x4000038240300330ull, 0x400003c840065033ull, 0xc000000430334400ull,
+    0xc000002430113400ull, 0x0ull, 0x4000021c30044403ull, 0x4000030834300053ull,
+    0x400001be31133530ull, 0x4000009830430433ull, 0x4000021830046403ull, 0xc000006011300433ull,
+    0x4000008401330304ull, 0x0ull, 0xc000000230333104ull, 0x4000000710314305ull,
+    0x4000029403340301ull, 0x400001a011300344ull, 0xc000000413103303ull, 0x4000024430056003ull,
+    0x40000b8214300350ull, 0x4000000630140304ull, 0x4000008803343033ull, 0xc000000410333404ull,
+    0x0ull, 0x4000002430145300ull, 0x4000000313101343ull, 0xc000002410313400ull,
+    0x4000001f30314304ull, 0x4000018413400305ull, 0x4000000634300450ull, 0x400000bc04033300ull,
+    0x400000d030140313ull, 0x0ull, 0xc00000d034000334ull, 0x4000018210300305ull,
+    0xc00000a811333400ull, 0xc000008833100034ull, 0x4000000010314103ull, 0x0ull,
+    0x4000000630144304ull, 0x0ull, 0x400013a534034433ull, 0x4000000634003104ull,
+    0x4000008c30540301ull, 0xc000008811100334ull, 0xc000008810400444ull, 0x0ull,
+    0xc000000713103304ull, 0x4000000213101343ull, 0xc000000130343004ull, 0x0ull,
+    0x0ull, 0x4000000430430113ull, 0x0ull, 0x0ull,
+    0xc000030843400043ull, 0xc000008611313144ull, 0x0ull, 0xc000000213330303ull,
+    0x4000018434300404ull, 0x4000000310314305ull, 0xc000018003400431ull, 0x4000008410440304ull,
+    0x0ull, 0xc00000c013140034ull, 0xc000000f13330033ull, 0x4000002440304300ull,
+    0x400000d034300313ull, 0xc00000c030440034ull, 0xc000025033300413ull, 0xc00001a043400434ull,
+    0x0ull, 0xc00000ac11333300ull, 0x4000000404310304ull, 0x4000000730344003ull,
+    0xc0000b8243600440ull, 0xc000000210003333ull, 0x0ull, 0xc00001f143400435ull,
+    0x0ull, 0x40000f8234300340ull, 0x0ull, 0xc000038443500501ull,
+    0x4000000111330305ull, 0x4000035a10004343ull, 0x0ull, 0x4000002f10304403ull,
+    0x0ull, 0x4000008410314103ull, 0x4000000010440304ull, 0x0ull,
+    0x4000038434400103ull, 0x4000000400131043ull, 0xc0000e8433430401ull, 0xc000002830334050ull,
+    0x400001f111100343ull, 0x0ull, 0xc000009033400334ull, 0x0ull,
+    0x4000000630314303ull, 0x4000000713014303ull, 0x4000000205300340ull, 0x4000000610304304ull,
+    0x4000008411330105ull, 0xc000018413400505ull, 0x4000008634300340ull, 0x0ull,
+    0x4000008f10303046ull, 0x0ull, 0x400000a630140303ull, 0x0ull,
+    0x0ull, 0xc000000410303404ull, 0x0ull, 0x4000000430440304ull,
+    0x4000009034300443ull, 0x0ull, 0x4000000534300105ull, 0x400001e134300443ull,
+    0x4000000413330005ull, 0x4000000730141103ull, 0xc000000614040003ull, 0x0ull,
+    0x0ull, 0xc00000d011400534ull, 0x4000000630344103ull, 0x4000000640303303ull,
+    0x4000000430314103ull, 0xc000018213400430ull, 0x0ull, 0xc00000c811100544ull,
+    0xc000000010340104ull, 0x0ull, 0x4000000410315300ull, 0x4000000404300304ull,
+    0x4000018434300114ull, 0xc000009c30130604ull, 0xc00000c030130044ull, 0xc00001a111400434ull,
+    0xc000000230400350ull, 0x40000bd034300343ull, 0x0ull, 0x0ull,
+    0x400000c030150404ull, 0x0ull, 0x4000020c34003043ull, 0x4000021034400343ull,
+    0x0ull, 0x400001a040300333ull, 0x4000008811100453ull, 0x4000002400355300ull,
+    0xc000018213400450ull, 0x4000002611113345ull, 0x400006a500033335ull, 0x4000009c34300601ull,
+    0x0ull, 0xc000018f41303063ull, 0xc000000310333304ull, 0xc0000bd043500634ull,
+    0x4000000630144303ull, 0x4000000630304103ull, 0x4000009830440404ull, 0x400001a211100354ull,
+    0x4000000000351303ull, 0x0ull, 0x0ull, 0xc000000633103330ull,
+    0x4000000311100343ull, 0xc000008831400034ull, 0x400002f030440334ull, 0x4000000330304304ull,
+    0x4000000000354301ull, 0x0ull, 0xc000000633300040ull, 0xc00001a103400434ull,
+    0xc000003c30334600ull, 0x0ull, 0x0ull, 0x4000000214001343ull,
+    0xc000002410334400ull, 0x0ull, 0xc000000730333406ull, 0x4000018134100143ull,
+    0xc000020f33303034ull, 0xc000000400343404ull, 0x400000c034100443ull, 0x4000018e34300050ull,
+    0x4000000230304304ull, 0x0ull, 0xc000009030130404ull, 0x4000018634100103ull,
+    0xc00000cc33400601ull, 0xc000000633300444ull, 0x4000000730304103ull, 0x4000000410310304ull,
+    0x4000000230334130ull, 0x0ull, 0x0ull, 0x4000018004000343ull,
+    0x4000000400344103ull, 0x0ull, 0x4000030443303503ull, 0xc000000630333105ull,
+    0x0ull, 0x0ull, 0x40000a4411344103ull, 0x4000018f31303035ull,
+    0x4000000211101343ull, 0xc000008413330404ull, 0x400006a144300343ull, 0x4000002b11100343ull,
+    0x0ull, 0x4000008804000343ull, 0xc00001a103400415ull, 0x4000008834300053ull,
+    0xc000008411430405ull, 0xc000000233103130ull, 0x0ull, 0xc000008633400104ull,
+    0x4000024013035003ull, 0x400000dc34300501ull, 0x0ull, 0xc000000630313405ull,
+    0xc000008833400040ull, 0x400000c034300401ull, 0xc000000230333304ull, 0xc000090433303404ull,
+    0x4000000001340304ull, 0xc00001e043400434ull, 0x4000000010330104ull, 0x0ull,
+    0x0ull, 0x4000000710314103ull, 0x400001b311100343ull, 0x400001a134100313ull,
+    0x4000009830430333ull, 0xc000008430430405ull, 0x4000000000344103ull, 0x4000000110314303ull,
+    0x4000000e34300040ull, 0xc000018243400430ull, 0x4000002240304350ull, 0x40000b8834400043ull,
+    0x4000038434300301ull, 0x4000000410430103ull, 0x4000000434300105ull, 0x400000c014100343ull,
+    0x0ull, 0x400000d034300443ull, 0x4000008411330304ull, 0x4000000630344003ull,
+    0xc000008830130054ull, 0x4000006f00334033ull, 0x0ull, 0x4000000710344305ull,
+    0x4000039610003334ull, 0x4000008e34300040ull, 0x4000000513014103ull, 0xc000008411430304ull,
+    0x4000000411103340ull, 0x4000009031100343ull, 0xc00000e030130333ull, 0x0ull,
+    0x4000000213130305ull, 0x400001e211100343ull, 0xc000000711330103ull, 0xc000002430313400ull,
+    0x4000002c10304033ull, 0xc000009813110433ull, 0x0ull, 0xc000000000343103ull,
+    0x4000021030044403ull, 0x400002c003440301ull, 0x4000000434300103ull, 0x400000c013130043ull,
+    0xc000000230313303ull, 0x0ull, 0x400002c031400343ull, 0xc000008613400440ull,
+    0x4000008430340103ull, 0x0ull, 0x400000e034300444ull, 0x4000018634300340ull,
+    0x4000009c30140303ull, 0x4000038834300053ull, 0xc000000333101334ull, 0x0ull,
+    0x4000000230314304ull, 0xc000000730313404ull, 0x4000000203143304ull, 0x4000009035000443ull,
+    0x4000000234300140ull, 0x4000096c40464033ull, 0x4000003c04033300ull, 0x4000000240300330ull,
+    0x4000000610344303ull, 0x0ull, 0x4000000634300040ull, 0xc000190743403103ull,
+    0x4000000630114304ull, 0x0ull, 0xc000002830335400ull, 0xc000000430313404ull,
+    0x4000000630354003ull, 0x4000018403340301ull, 0xc00001a104400434ull, 0x400001e134300445ull,
+    0x4000008410313334ull, 0x4000009830130343ull, 0x0ull, 0x4000000733103504ull,
+    0xc000000e13330030ull, 0xc00000c011140034ull, 0x400003a010003340ull, 0x0ull,
+    0x4000000710314303ull, 0x0ull, 0xc00000d033400414ull, 0xc000000333103304ull,
+    0x400000d034100443ull, 0x4000000613004103ull, 0x4000008834100053ull, 0xc000000230130305ull,
+    0x4000025034400343ull, 0x4000000430440003ull, 0x4000018014300341ull, 0xc000002430133400ull,
+    0x400003a114400343ull, 0x0ull, 0xc000000003131303ull, 0x0ull,
+    0x4000000734300103ull, 0x4000000430304103ull, 0xc000000400333404ull, 0xc000003f13330403ull,
+    0xc000000710313106ull, 0xc000038243500130ull, 0x400001fb11100354ull, 0x4000000403143404ull,
+    0xc000000000333103ull, 0x4000000413310314ull, 0x4000000130314304ull, 0x4000000404330304ull,
+    0x4000000313330306ull, 0x4000018211300360ull, 0xc000018243400441ull, 0x4000000730140305ull,
+    0x0ull, 0xc00000ce13440030ull, 0x4000000010300343ull, 0x4000008711313135ull,
+    0x4000028c30540301ull, 0x4000000604330360ull, 0x0ull, 0x4000038440300301ull,
+    0x0ull, 0xc00001a043400115ull, 0xc000000410331104ull, 0xc000000211330303ull,
+    0x40000ac811430053ull, 0x0ull, 0xc000001713310504ull, 0x4000038410003334ull,
+    0x4000009030140403ull, 0xc000038443500105ull, 0x4000008430045304ull, 0xc00007a500057434ull,
+    0x4000000210301343ull, 0x4000000410341303ull, 0xc000000000331103ull, 0x400008bc30445300ull,
+    0x0ull, 0x0ull, 0x40000af814300344ull, 0x0ull,
+    0xc000008633400105ull, 0xc000002733300105ull, 0x0ull, 0x400000dc30350401ull,
+    0x4000038834400043ull, 0xc000000430333404ull, 0x400000d040100343ull, 0x400003b610004335ull,
+    0x4000018405300301ull, 0x4000000010330304ull, 0x0ull, 0xc000000730133404ull,
+    0x4000038434300104ull, 0xc00000b011100435ull, 0xc000000230133303ull, 0x0ull,
+    0x40000b0834400043ull, 0x0ull, 0x4000002730345304ull, 0xc00000d011100534ull,
+    0x4000000730344103ull, 0xc000000213300330ull, 0x4000000330344304ull, 0xc00001a313400445ull,
+    0x4000009434300401ull, 0x4000008830130343ull, 0xc000000130313303ull, 0x0ull,
+    0xc000038443500401ull, 0x4000000740303303ull, 0xc000000000333303ull, 0xc000000230331303ull,
+    0x40001adc30440301ull, 0x0ull, 0x0ull, 0x4000019111100343ull,
+    0x4000000634300340ull, 0x0ull, 0x0ull, 0x4000008411310304ull,
+    0xc000018010500434ull, 0xc000000613103405ull, 0x4000008634300140ull, 0xc000008831100034ull,
+    0x400000c030440033ull, 0xc000000010333303ull, 0x400000ab11100354ull, 0xc000000110313104ull,
+    0x400000a930140034ull, 0x4000002430144301ull, 0xc00000f033400434ull, 0xc00000a811100445ull,
+    0x4000000230140030ull, 0x0ull, 0xc000000630313105ull, 0xc00000c033400334ull,
+    0x4000018234300150ull, 0xc000000010330133ull, 0x4000000413310405ull, 0x4000000403141301ull,
+    0x4000000210314304ull, 0x0ull, 0x4000038434300401ull, 0x400001a034300344ull,
+    0x0ull, 0x4000000230344304ull, 0xc000018243400440ull, 0xc000000510313105ull,
+    0xc000009013100434ull, 0xc000018013400434ull, 0x0ull, 0x4000009c14300301ull,
+    0x400001a110400343ull, 0x0ull, 0x4000002240305350ull, 0x4000000413101053ull,
+    0x400001f105300343ull, 0x4000000000354303ull, 0xc000000713330303ull, 0x0ull,
+    0x40000a9c03340301ull, 0x4000006700354003ull, 0x0ull, 0x4000000210300360ull,
+    0xc000000030313303ull, 0x0ull, 0x4000008830530344ull, 0x4000000230140305ull,
+    0x4000009c30440404ull, 0x4000002c10345300ull, 0xc00001e104400535ull, 0xc00000f011100535ull,
+    0xc00001a013400435ull, 0x0ull, 0xc000000130333104ull, 0xc000000010330113ull,
+    0x0ull, 0x4000000400354301ull, 0x4000000634300106ull, 0xc00000c033000434ull,
+    0x4000000403153003ull, 0x0ull, 0x4000008c30140403ull, 0x4000000700344304ull,
+    0x0ull, 0x0ull, 0xc000000730333404ull, 0x0ull,
+    0xc000000640303505ull, 0xc000000410333401ull, 0xc000028e33404034ull, 0x4000018011100343ull,
+    0x4000002810345300ull, 0x400001a005300343ull, 0x0ull, 0x4000002430045300ull,
+    0x4000000613310360ull, 0x4000028c10003034ull, 0x400001a134300144ull, 0x4000000611100354ull,
+    0x0ull, 0xc000068433430401ull, 0x0ull, 0x40000b8434300301ull,
+    0x400001a031300343ull, 0xc00001e113400535ull, 0x4000000113330305ull, 0x4000000710304304ull,
+    0x400001a114300344ull, 0x40000acc34300501ull, 0x400001a131300345ull, 0x4000018430500104ull,
+    0x4000000210304130ull, 0x4000000730314305ull, 0x0ull, 0x4000000404330004ull,
+    0x4000008835000043ull, 0x4000000410430130ull, 0xc000000010333103ull, 0x4000002610315104ull,
+    0x4000009034000443ull, 0x0ull, 0x4000008c40300301ull, 0x4000021c30044303ull,
+    0xc000000330333305ull, 0x0ull, 0x4000003c30345300ull, 0x4000000310314103ull,
+    0x4000000003141303ull, 0x0ull, 0x4000000030314303ull, 0x4000000240303340ull,
+    0x0ull, 0x400000c030140333ull, 0x4000000400344303ull, 0x0ull,
+    0x400000c411330005ull, 0x4000000404300405ull, 0xc00001e011100535ull, 0x4000009c30440301ull,
+    0xc000000110330133ull, 0x0ull, 0xc000000413101303ull, 0x4000000010340303ull,
+    0x4000190734303103ull, 0x400006a144400313ull, 0x400000a810304033ull, 0x4000000404330301ull,
+    0x4000018434300303ull, 0xc00000c013140033ull, 0x400000c034300443ull, 0x400003b710003335ull,
+    0x4000000000430113ull, 0xc000000630313404ull, 0x4000020830044403ull, 0x4000000640304103ull,
+    0x4000030433004403ull, 0x4000132c33304443ull, 0x4000009434300301ull, 0x4000000703151003ull,
+    0xc00000c813340031ull, 0xc000020c33003033ull, 0x4000000304043043ull, 0x4000028c03440301ull,
+    0x0ull, 0x0ull, 0x4000000000355300ull, 0x4000000703143304ull,
+    0xc000009c30430601ull, 0x4000000410344003ull, 0xc00000c813440034ull, 0x0ull,
+    0x4000000240300340ull, 0x4000000410304303ull, 0x4000081c30444301ull, 0x400000dc34300301ull,
+    0x4000002713103504ull, 0x0ull, 0x4000000610430130ull, 0x4000000430450004ull,
+    0xc000000700333404ull, 0x0ull, 0x4000090734400103ull, 0x4000024411344003ull,
+    0x400001a110300343ull, 0x4000002f40304304ull, 0xc00001a150500435ull, 0x400002bc34003500ull,
+    0x0ull, 0x4000008410300304ull, 0x4000000613310406ull, 0x4000030433004504ull,
+    0x4000000233101343ull, 0xc000000413103404ull, 0x400000c234300440ull, 0x4000000630341303ull,
+    0x4000009034300343ull, 0x4000009411330304ull, 0x400003d410003434ull, 0x4000000330344103ull,
+    0x4000008830440033ull, 0x0ull, 0xc00001e043400535ull, 0x0ull,
+    0x4000000400351301ull, 0x0ull, 0x400000d811100343ull, 0x4000008810430343ull,
+    0x0ull, 0x4000000734300304ull, 0xc000000410430405ull, 0x4000008c11103034ull,
+    0x0ull, 0x0ull, 0x4000000400330304ull, 0x4000030430006103ull,
+    0x4000000630314304ull, 0xc000000230133304ull, 0xc000002c30133500ull, 0x0ull,
+    0x4000038214300350ull, 0x4000000413103403ull, 0x4000038234300350ull, 0x4000009830530334ull,
+    0xc000008413330303ull, 0x400000c813330053ull, 0xc00000e111400435ull, 0xc00000c011100434ull,
+    0x400000c434300401ull, 0x400000e030150404ull, 0x0ull, 0xc000000411330103ull,
+    0xc000000614030404ull, 0xc000000403133401ull, 0xc00000b233105330ull, 0x4000018634300104ull,
+    0xc00001e013400534ull, 0xc000000430430405ull, 0x40000b8434300104ull, 0xc000000230330150ull,
+    0x40000ff134300344ull, 0x400003a134400343ull, 0xc000000413300501ull, 0x4000002e30343030ull,
+    0x0ull, 0x0ull, 0xc000000f13110403ull, 0x4000000630144003ull,
+    0xc000000140100334ull, 0x4000028e34300040ull, 0x4000008430430113ull, 0x4000000010440104ull,
+    0x0ull, 0xc000000533101405ull, 0x0ull, 0xc000000e13330403ull,
+    0x4000000240303330ull, 0x4000020830044300ull, 0xc0000b0841400033ull, 0xc00000ba33105330ull,
+    0x0ull, 0xc000000313330103ull, 0x0ull, 0x4000000140304404ull,
+    0x0ull, 0x400001a131300343ull, 0x0ull, 0xc000006133300434ull,
+    0x400003e111400343ull, 0x0ull, 0x0ull, 0x4000000713044003ull,
+    0xc000000730131404ull, 0x4000008834300043ull, 0x0ull, 0x4000000a00333343ull,
+    0xc00000bc11333300ull, 0xc000000210333304ull, 0x400000e130140334ull, 0xc00000c013100434ull,
+    0x4000000403143104ull, 0x400001a311100343ull, 0x0ull, 0x4000002330410134ull,
+    0x0ull, 0x400000ab34300404ull, 0x4000002410346300ull, 0x4000008c34300054ull,
+    0x0ull, 0x4000002240303340ull, 0x4000002413330305ull, 0x0ull,
+    0xc000008430130406ull, 0x4000000330314303ull, 0x0ull, 0x4000002830334333ull,
+    0x0ull, 0x0ull, 0x400001be31333530ull, 0x4000008403341301ull,
+    0x0ull, 0xc000000010330303ull, 0x4000002730430113ull, 0x4000000334100354ull,
+    0xc00001b011100535ull, 0x400000c034300301ull, 0x0ull, 0x4000008400130043ull,
+    0x4000008711313146ull, 0x0ull, 0x4000008430430003ull, 0xc00000bc11333400ull,
+    0x4000002210335130ull, 0x400001a134000343ull, 0x4000008830430033ull, 0x4000000411330405ull,
+    0x400003f710003335ull, 0x4000000611100343ull, 0x400002dc30440301ull, 0xc000000730331405ull,
+    0x0ull, 0x4000000f30333343ull, 0x0ull, 0x4000000e30344303ull,
+    0xc000000003133301ull, 0xc000000433300104ull, 0xc00003a743500105ull, 0x400000bb30130343ull,
+    0x0ull, 0x4000000213034304ull, 0x0ull, 0x0ull,
+    0xc0000bd043400434ull, 0xc00000fc11343500ull, 0xc000008411330303ull, 0x4000008404340405ull,
+    0x0ull, 0x4000000603040030ull, 0xc00006a500047334ull, 0xc000008833400031ull,
+    0x4000000410314130ull, 0x0ull, 0x0ull, 0x4000030443304103ull,
+    0xc000002831300034ull, 0x0ull, 0x400000f031300444ull, 0x400001a343000443ull,
+    0x400000c013430005ull, 0xc00001a143400436ull, 0x0ull, 0x0ull,
+    0x0ull, 0xc000008c11430304ull, 0x4000000330341305ull, 0x4000009c30140304ull,
+    0xc000000430333004ull, 0x4000000413330405ull, 0xc000000405003104ull, 0x0ull,
+    0xc000000630130405ull, 0x400001a111300344ull, 0xc00001e143400535ull, 0x0ull,
+    0xc000002310314106ull, 0xc00000c213400430ull, 0x400001f134300445ull, 0x400000c130150405ull,
+    0x400001a134300344ull, 0x0ull, 0x4000000000340304ull, 0x4000000700344303ull,
+    0x4000030210004343ull, 0xc000000313330303ull, 0xc000000413101404ull, 0xc000000713330103ull,
+    0x4000009c13330304ull, 0x4000002710314103ull, 0x4000000730400103ull, 0xc000000410343004ull,
+    0xc000000210103333ull, 0x4000008830540044ull, 0x4000009c30430303ull, 0x4000002330344304ull,
+    0x4000000140100343ull, 0x4000000730314304ull, 0x0ull, 0x4000000f30343033ull,
+    0x4000000010314303ull, 0x0ull, 0x4000000234300040ull, 0x400002e003350404ull,
+    0x0ull, 0x400000bc33103700ull, 0x4000000700344103ull, 0x4000000411103450ull,
+    0x400000c014300343ull, 0x0ull, 0xc000018003400501ull, 0x4000001f10314304ull,
+    0x4000000730151003ull, 0x4000000003140301ull, 0x0ull, 0xc000000710313405ull,
+    0xc000002931300034ull, 0x4000029010400343ull, 0xc000000414100405ull, 0xc00000e811100545ull,
+    0x4000008835000053ull, 0xc000018240500440ull, 0xc000000704030404ull, 0x0ull,
+    0x400000d035000343ull, 0x4000000634300104ull, 0xc000002733300103ull, 0x4000008400350301ull,
+    0x4000000230430130ull, 0x4000068433440301ull, 0x4000000710341303ull, 0x4000030434400404ull,
+    0x4000000411100343ull, 0xc000000530303105ull,
+};
+
+#endif
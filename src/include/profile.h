@@ -0,0 +1,222 @@
+/**
+ * Hot-path timers and counters, compiled in only with -DMINESWEEPER_PROFILE (cmake -DMINESWEEPER_PROFILE=ON).
+ *
+ * PROFILE_SCOPE(kTimer) times the rest of the enclosing block with the time-stamp counter, adding the cycles to the
+ * timer's total and to a log2 latency histogram. PROFILE_COUNT(kCounter, amount) adds to an event counter. Timers are
+ * inclusive: a VisitBlock() made from inside Decide() counts towards both. Every thread records into its own slots, so
+ * games played side by side do not share cache lines on the hot path; ProfileReport() sums them.
+ *
+ * Without MINESWEEPER_PROFILE both macros expand to nothing (their arguments are not even evaluated) and
+ * ProfileReport() is an empty inline function, so the instrumented code compiles to what it was before.
+ *
+ * ProfileReport() writes to the file named by the MINESWEEPER_PROFILE_OUT environment variable, as CSV if the name
+ * ends in ".csv" and as JSON otherwise, or as JSON to stderr if the variable is unset. The server calls it from
+ * ExitGame() and the batch drivers once all their games are over.
+ */
+#ifndef PROFILE_H
+#define PROFILE_H
+
+enum ProfileTimer {
+  kTimeVisitBlock,
+  kTimeMarkMine,
+  kTimeAutoExplore,
+  kTimeFloodVisit,
+  kTimePrintMap,
+  kTimeReadMap,        // the client taking in a map, from text or from the rendered frame
+  kTimeTextRoundTrip,  // Execute() printing the map to a string and reading it back
+  kTimeDecide,         // one whole move of the client
+  kTimePatternLookup,
+  kTimeDeduceFrontier,
+  kTimeProbabilities,
+  kTimeProbeFrontier,
+  kTimeSampledGuess,
+  kProfileTimerCount
+};
+
+enum ProfileCounter {
+  kCountFloods,                // FloodVisitFrom() calls that opened a cell
+  kCountCellsRevealed,         // cells those calls opened
+  kCountDecideReplayed,        // moves taken from the planned-action queue
+  kCountDecideSingleCell,      // moves found by the single-cell rules
+  kCountDecidePattern,         // moves found in the pattern table
+  kCountDecideDeduced,         // moves found by the linear constraint engine
+  kCountDecideMineCount,       // moves forced by the total mine count
+  kCountDecideProbed,          // moves found by contradiction probing
+  kCountGuesses,               // moves that had to guess
+  kCountComponentCacheHits,    // frontier components found solved in a ComponentCache
+  kCountComponentCacheMisses,  // frontier components that had to be enumerated
+  kProfileCounterCount
+};
+
+#ifdef MINESWEEPER_PROFILE
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+constexpr const char *kProfileTimerNames[kProfileTimerCount] = {
+    "visit_block",    "mark_mine",       "auto_explore",  "flood_visit",    "print_map",     "read_map",
+    "text_round_trip", "decide",         "pattern_lookup", "deduce_frontier", "probabilities", "probe_frontier",
+    "sampled_guess"};
+constexpr const char *kProfileCounterNames[kProfileCounterCount] = {
+    "floods",         "cells_revealed", "decide_replayed", "decide_single_cell",
+    "decide_pattern", "decide_deduced", "decide_mine_count", "decide_probed", "guesses", "component_cache_hits",
+    "component_cache_misses"};
+
+// Bucket b of a latency histogram holds the spans of [2^(b-1), 2^b) ticks, bucket 0 those of zero ticks
+constexpr int kProfileBuckets = 48;
+
+namespace profile_detail {
+
+inline uint64_t Ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+struct alignas(64) ThreadProfile {
+  uint64_t calls[kProfileTimerCount] = {};
+  uint64_t ticks[kProfileTimerCount] = {};
+  uint64_t histogram[kProfileTimerCount][kProfileBuckets] = {};
+  uint64_t counters[kProfileCounterCount] = {};
+};
+
+// Every thread's slots, owned here so that they outlive the threads that filled them
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadProfile>> threads;
+  const uint64_t start_ticks = Ticks();
+  const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+};
+
+inline Registry &GlobalRegistry() {
+  static Registry registry;
+  return registry;
+}
+
+inline ThreadProfile &Local() {
+  thread_local ThreadProfile *slots = [] {
+    Registry &registry = GlobalRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.threads.push_back(std::make_unique<ThreadProfile>());
+    return registry.threads.back().get();
+  }();
+  return *slots;
+}
+
+class Scope {
+ public:
+  explicit Scope(ProfileTimer timer) : timer_(timer), start_(Ticks()) {}
+  ~Scope() {
+    const uint64_t elapsed = Ticks() - start_;
+    ThreadProfile &profile = Local();
+    ++profile.calls[timer_];
+    profile.ticks[timer_] += elapsed;
+    const int bucket = elapsed == 0 ? 0 : 64 - __builtin_clzll(elapsed);
+    ++profile.histogram[timer_][bucket < kProfileBuckets ? bucket : kProfileBuckets - 1];
+  }
+  Scope(const Scope &) = delete;
+  Scope &operator=(const Scope &) = delete;
+
+ private:
+  ProfileTimer timer_;
+  uint64_t start_;
+};
+
+inline void WriteJson(std::ostream &out, const ThreadProfile &total, double ns_per_tick) {
+  out << "{\n  \"ns_per_tick\": " << ns_per_tick << ",\n  \"counters\": {";
+  for (int i = 0; i < kProfileCounterCount; ++i) {
+    out << (i ? ", " : "") << '"' << kProfileCounterNames[i] << "\": " << total.counters[i];
+  }
+  out << "},\n  \"timers\": {\n";
+  for (int t = 0; t < kProfileTimerCount; ++t) {
+    out << "    \"" << kProfileTimerNames[t] << "\": {\"calls\": " << total.calls[t]
+        << ", \"ticks\": " << total.ticks[t] << ", \"ns\": " << total.ticks[t] * ns_per_tick << ", \"histogram\": [";
+    int last = kProfileBuckets - 1;
+    while (last > 0 && total.histogram[t][last] == 0) --last;
+    for (int b = 0; b <= last; ++b) out << (b ? ", " : "") << total.histogram[t][b];
+    out << "]}" << (t + 1 < kProfileTimerCount ? "," : "") << "\n";
+  }
+  out << "  }\n}\n";
+}
+
+inline void WriteCsv(std::ostream &out, const ThreadProfile &total, double ns_per_tick) {
+  out << "kind,name,bucket,value\n";
+  for (int i = 0; i < kProfileCounterCount; ++i) {
+    out << "counter," << kProfileCounterNames[i] << ",," << total.counters[i] << "\n";
+  }
+  for (int t = 0; t < kProfileTimerCount; ++t) {
+    out << "calls," << kProfileTimerNames[t] << ",," << total.calls[t] << "\n";
+    out << "ns," << kProfileTimerNames[t] << ",," << total.ticks[t] * ns_per_tick << "\n";
+    for (int b = 0; b < kProfileBuckets; ++b) {
+      if (total.histogram[t][b] == 0) continue;
+      out << "histogram," << kProfileTimerNames[t] << "," << b << "," << total.histogram[t][b] << "\n";
+    }
+  }
+}
+
+}  // namespace profile_detail
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(timer) profile_detail::Scope PROFILE_CONCAT(profile_scope_, __LINE__)(timer)
+#define PROFILE_COUNT(counter, amount) (profile_detail::Local().counters[counter] += static_cast<uint64_t>(amount))
+
+/**
+ * Sum the slots of every thread so far and write them out (see the top of this file). Call it when no thread is
+ * recording any more.
+ */
+inline void ProfileReport() {
+  profile_detail::Registry &registry = profile_detail::GlobalRegistry();
+  profile_detail::ThreadProfile total;
+  {
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto &slots : registry.threads) {
+      for (int t = 0; t < kProfileTimerCount; ++t) {
+        total.calls[t] += slots->calls[t];
+        total.ticks[t] += slots->ticks[t];
+        for (int b = 0; b < kProfileBuckets; ++b) total.histogram[t][b] += slots->histogram[t][b];
+      }
+      for (int i = 0; i < kProfileCounterCount; ++i) total.counters[i] += slots->counters[i];
+    }
+  }
+  const uint64_t ticks = profile_detail::Ticks() - registry.start_ticks;
+  const double ns =
+      std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - registry.start_time).count();
+  const double ns_per_tick = ticks > 0 ? ns / ticks : 0.0;
+  const char *path = std::getenv("MINESWEEPER_PROFILE_OUT");
+  if (path == nullptr) {
+    profile_detail::WriteJson(std::cerr, total, ns_per_tick);
+    return;
+  }
+  const std::string name = path;
+  std::ofstream out(name);
+  if (name.size() >= 4 && name.compare(name.size() - 4, 4, ".csv") == 0) {
+    profile_detail::WriteCsv(out, total, ns_per_tick);
+  } else {
+    profile_detail::WriteJson(out, total, ns_per_tick);
+  }
+}
+
+#else
+
+#define PROFILE_SCOPE(timer) ((void)0)
+#define PROFILE_COUNT(counter, amount) ((void)0)
+
+inline void ProfileReport() {}
+
+#endif
+
+#endif
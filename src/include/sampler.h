@@ -0,0 +1,440 @@
+/**
+ * Monte Carlo guess evaluation.
+ *
+ * Samples mine layouts consistent with every revealed number and with the total mine count, and estimates from them
+ * each candidate's mine probability and the expected information gain of visiting it. Used for frontier components
+ * too large for the exact enumeration of the client.
+ *
+ * A layout is a 0/1 value per frontier variable plus the number of mines among the interior unknowns. The interior
+ * cells are interchangeable, so a layout with m frontier mines has weight C(interior, mines_left - m). Each chain is
+ * a block Gibbs sampler: it grows a block of connected variables around a random one, enumerates every assignment of
+ * the block that keeps the constraints satisfied with the rest of the layout fixed, and draws one in proportion to its
+ * weight. Block sizes are drawn from 8 up to 64 variables, so that long chains of 1-2-1 style patterns, which can only
+ * switch between their layouts all at once, still mix. An update whose enumeration exceeds kSamplerBlockNodes leaves
+ * the layout as it is; the enumeration does not depend on the block's current values, so this keeps the chain
+ * reversible.
+ *
+ * Chains run on the shared worker pool of scheduler.h (ParallelFor), a few per thread, each with its own RNG stream
+ * seeded from the chain index. They stop at a wall-clock deadline, so a guess stays inside the time limit and the
+ * number of samples grows with the cores, or at a per-chain sample cap. Totals are merged in chain order, so a run with
+ * a fixed number of chains and a sample cap (and no time budget) gives the same result on any number of threads.
+ */
+#ifndef SAMPLER_H
+#define SAMPLER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "scheduler.h"
+
+constexpr int kSamplerMinBlockSize = 8;        // variables resampled together by one Gibbs update, doubling up to
+constexpr int kSamplerMaxBlockSize = 64;       // the width of a block assignment
+constexpr long kSamplerBlockNodes = 1L << 14;  // search nodes allowed to one block update
+constexpr int kSamplerBurnInSweeps = 4;        // sweeps of a chain before it starts recording samples
+constexpr long kSamplerStartNodes = 1L << 16;  // search nodes allowed to find a chain's starting layout
+
+/**
+ * The layouts to sample: `variables` 0/1 unknowns, each constraint asking for exactly `mines` of its variables to be
+ * mines, and `interior` further unknowns that hold the rest of `mines_left`.
+ */
+struct SamplingProblem {
+  struct Constraint {
+    std::vector<int> variables;
+    int mines;
+  };
+  // A cell whose visit is evaluated: a frontier variable (or -1 for an interior cell) and its unknown neighbours
+  struct Candidate {
+    int variable;
+    std::vector<int> neighbor_variables;
+    int interior_neighbors;
+  };
+  int variables = 0;
+  int interior = 0;
+  int mines_left = 0;
+  std::vector<Constraint> constraints;
+  std::vector<Candidate> candidates;
+};
+
+struct SamplerOptions {
+  int chains = 0;               // independent chains; 0 runs chains_per_thread per worker thread
+  int chains_per_thread = 2;    // so that a chain stuck in a slow region does not idle a core
+  int threads = 0;              // worker threads; 0 uses every hardware thread
+  double time_budget_ms = 2.0;  // wall-clock budget of the whole run; 0 for none (then the cap must be set)
+  int samples_per_chain = 0;    // cap on the samples of each chain; 0 for no cap
+  uint64_t seed = 0;
+};
+
+struct SamplerResult {
+  long samples = 0;                       // samples recorded over all chains, 0 if no layout was found
+  std::vector<double> mine_probability;   // per variable
+  double interior_probability = 0.0;      // per interior cell
+  std::vector<double> safe_probability;   // per candidate
+  std::vector<double> information_gain;   // per candidate: entropy in bits of the number it would reveal, if safe
+};
+
+namespace sampler_detail {
+
+struct ChainTotals {
+  long samples = 0;
+  std::vector<double> mines;       // per variable: samples where it is a mine
+  double interior_mines = 0.0;     // sum over samples of the interior mine count
+  std::vector<double> revealed;    // per candidate: 9 bins of the number revealed, weighted by the chance it is safe
+};
+
+// An assignment of the block being updated: bit i for block variable i
+struct BlockSolution {
+  uint64_t bits;
+  int mines;
+};
+
+// Storage of one chain, kept by the caller (see SamplerScratch)
+struct ChainStorage {
+  ChainTotals totals;
+  std::vector<int> touching_begin, touching;  // flat per-variable lists: variable v owns [begin[v], begin[v + 1])
+  std::vector<int> linked_begin, linked;
+  std::vector<int> seen;                      // building scratch of the lists
+  std::vector<signed char> value;
+  std::vector<int> sum;
+  std::vector<int> block;
+  std::vector<bool> in_block;
+  std::vector<int> open;
+  std::vector<int> start_open;
+  std::vector<BlockSolution> solutions;
+  std::vector<double> weights;
+};
+
+class Chain {
+ public:
+  Chain(const SamplingProblem &problem, uint64_t seed, ChainStorage &storage)
+      : problem_(problem),
+        rng_(seed),
+        touching_begin_(storage.touching_begin),
+        touching_(storage.touching),
+        linked_begin_(storage.linked_begin),
+        linked_(storage.linked),
+        value_(storage.value),
+        sum_(storage.sum),
+        block_(storage.block),
+        in_block_(storage.in_block),
+        open_(storage.open),
+        start_open_(storage.start_open),
+        solutions_(storage.solutions),
+        weights_(storage.weights) {
+    // Flat lists rather than a vector per variable, so that reused storage stops allocating once it has held the
+    // largest problem instead of once every variable index has held its longest list
+    touching_begin_.assign(problem.variables + 1, 0);
+    for (const auto &constraint : problem.constraints) {
+      for (int v : constraint.variables) ++touching_begin_[v + 1];
+    }
+    for (int v = 0; v < problem.variables; ++v) touching_begin_[v + 1] += touching_begin_[v];
+    touching_.resize(touching_begin_[problem.variables]);
+    std::vector<int> &seen = storage.seen;
+    seen.assign(touching_begin_.begin(), touching_begin_.end() - 1);  // next free place of each list
+    for (int k = 0; k < static_cast<int>(problem.constraints.size()); ++k) {
+      for (int v : problem.constraints[k].variables) touching_[seen[v]++] = k;
+    }
+    seen.assign(problem.variables, 0);
+    linked_begin_.assign(1, 0);
+    linked_.clear();
+    for (int v = 0; v < problem.variables; ++v) {
+      seen[v] = v + 1;
+      for (int k : Touching(v)) {
+        for (int u : problem.constraints[k].variables) {
+          if (seen[u] == v + 1) continue;
+          seen[u] = v + 1;
+          linked_.push_back(u);
+        }
+      }
+      std::sort(linked_.begin() + linked_begin_.back(), linked_.end());
+      linked_begin_.push_back(static_cast<int>(linked_.size()));
+    }
+    value_.assign(problem.variables, 0);
+    sum_.assign(problem.constraints.size(), 0);
+    in_block_.assign(problem.variables, false);
+    open_.assign(problem.constraints.size(), 0);
+  }
+
+  /**
+   * Find a starting layout by randomized backtracking. Returns false if none turns up within kSamplerStartNodes.
+   */
+  bool Start() {
+    start_open_.resize(problem_.constraints.size());
+    for (size_t k = 0; k < start_open_.size(); ++k) {
+      start_open_[k] = static_cast<int>(problem_.constraints[k].variables.size());
+    }
+    long nodes = 0;
+    return Assign(0, 0, start_open_, nodes);
+  }
+
+  void Run(ChainTotals &totals, const SamplerOptions &options, std::chrono::steady_clock::time_point deadline) {
+    const int sweep = problem_.variables / kSamplerMinBlockSize + 1;
+    for (int i = 0; i < kSamplerBurnInSweeps * sweep; ++i) Update();
+    while (options.samples_per_chain == 0 || totals.samples < options.samples_per_chain) {
+      if (options.time_budget_ms > 0 && std::chrono::steady_clock::now() >= deadline) break;
+      for (int i = 0; i < sweep; ++i) Update();
+      Record(totals);
+    }
+  }
+
+ private:
+  // One of the flat per-variable lists
+  struct IndexRange {
+    const int *first, *last;
+    const int *begin() const { return first; }
+    const int *end() const { return last; }
+  };
+
+  // Constraints containing variable v
+  IndexRange Touching(int v) const {
+    return {touching_.data() + touching_begin_[v], touching_.data() + touching_begin_[v + 1]};
+  }
+
+  // Variables sharing a constraint with variable v, in increasing order
+  IndexRange Linked(int v) const {
+    return {linked_.data() + linked_begin_[v], linked_.data() + linked_begin_[v + 1]};
+  }
+
+  bool Assign(int v, int mines, std::vector<int> &open, long &nodes) {
+    if (++nodes > kSamplerStartNodes) return false;
+    if (v == problem_.variables) {
+      mines_ = mines;
+      const int rest = problem_.mines_left - mines;
+      return rest >= 0 && rest <= problem_.interior;
+    }
+    const int first = static_cast<int>(rng_() & 1u);
+    for (int t = 0; t < 2; ++t) {
+      const int mine = first ^ t;
+      if (mines + mine > problem_.mines_left) continue;
+      bool feasible = true;
+      for (int k : Touching(v)) {
+        --open[k];
+        sum_[k] += mine;
+        if (sum_[k] > problem_.constraints[k].mines || sum_[k] + open[k] < problem_.constraints[k].mines) {
+          feasible = false;
+        }
+      }
+      value_[v] = static_cast<signed char>(mine);
+      if (feasible && Assign(v + 1, mines + mine, open, nodes)) return true;
+      for (int k : Touching(v)) {
+        ++open[k];
+        sum_[k] -= mine;
+      }
+      if (nodes > kSamplerStartNodes) return false;
+    }
+    value_[v] = 0;
+    return false;
+  }
+
+  static double LogChoose(int n, int k) {
+    return std::lgamma(n + 1.0) - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0);
+  }
+
+  /**
+   * One block Gibbs update around a random variable.
+   */
+  void Update() {
+    if (problem_.variables == 0) return;
+    block_.clear();
+    const int seed = static_cast<int>(rng_() % problem_.variables);
+    int block_size = kSamplerMinBlockSize;
+    while (block_size < kSamplerMaxBlockSize && (rng_() & 1u)) block_size *= 2;
+    block_.push_back(seed);
+    in_block_[seed] = true;
+    for (size_t head = 0; head < block_.size() && static_cast<int>(block_.size()) < block_size; ++head) {
+      for (int u : Linked(block_[head])) {
+        if (in_block_[u]) continue;
+        in_block_[u] = true;
+        block_.push_back(u);
+        if (static_cast<int>(block_.size()) == block_size) break;
+      }
+    }
+    // Take the block out of the layout, then enumerate its consistent assignments
+    outside_mines_ = mines_;
+    for (int v : block_) {
+      outside_mines_ -= value_[v];
+      for (int k : Touching(v)) {
+        sum_[k] -= value_[v];
+        ++open_[k];
+      }
+    }
+    solutions_.clear();
+    nodes_ = 0;
+    const bool complete = Enumerate(0, 0, 0);
+    for (int v : block_) {
+      in_block_[v] = false;
+      for (int k : Touching(v)) {
+        --open_[k];
+        if (!complete) sum_[k] += value_[v];
+      }
+    }
+    if (!complete) return;
+    const int outside_mines = outside_mines_;
+    // Draw one assignment by weight C(interior, mines_left - total frontier mines)
+    double max_log = -1e300;
+    for (const auto &solution : solutions_) {
+      max_log = std::max(max_log, LogChoose(problem_.interior, problem_.mines_left - outside_mines - solution.mines));
+    }
+    double total = 0.0;
+    weights_.clear();
+    for (const auto &solution : solutions_) {
+      weights_.push_back(
+          std::exp(LogChoose(problem_.interior, problem_.mines_left - outside_mines - solution.mines) - max_log));
+      total += weights_.back();
+    }
+    double pick = std::uniform_real_distribution<double>(0.0, total)(rng_);
+    size_t chosen = 0;
+    while (chosen + 1 < solutions_.size() && pick >= weights_[chosen]) pick -= weights_[chosen++];
+    const uint64_t bits = solutions_[chosen].bits;
+    for (int i = 0; i < static_cast<int>(block_.size()); ++i) {
+      const int v = block_[i];
+      value_[v] = static_cast<signed char>((bits >> i) & 1u);
+      for (int k : Touching(v)) sum_[k] += value_[v];
+    }
+    mines_ = outside_mines + solutions_[chosen].mines;
+  }
+
+  // Returns false if the search ran out of nodes
+  bool Enumerate(int i, uint64_t bits, int mines) {
+    if (++nodes_ > kSamplerBlockNodes) return false;
+    if (i == static_cast<int>(block_.size())) {
+      const int rest = problem_.mines_left - outside_mines_ - mines;
+      if (rest >= 0 && rest <= problem_.interior) solutions_.push_back({bits, mines});
+      return true;
+    }
+    bool complete = true;
+    const int v = block_[i];
+    for (int mine = 0; mine <= 1; ++mine) {
+      bool feasible = true;
+      for (int k : Touching(v)) {
+        --open_[k];
+        sum_[k] += mine;
+        if (sum_[k] > problem_.constraints[k].mines || sum_[k] + open_[k] < problem_.constraints[k].mines) {
+          feasible = false;
+        }
+      }
+      if (feasible) complete = Enumerate(i + 1, bits | (static_cast<uint64_t>(mine) << i), mines + mine);
+      for (int k : Touching(v)) {
+        ++open_[k];
+        sum_[k] -= mine;
+      }
+      if (!complete) return false;
+    }
+    return true;
+  }
+
+  void Record(ChainTotals &totals) {
+    ++totals.samples;
+    for (int v = 0; v < problem_.variables; ++v) totals.mines[v] += value_[v];
+    const int interior_mines = problem_.mines_left - mines_;
+    totals.interior_mines += interior_mines;
+    const double interior_density = problem_.interior > 0 ? static_cast<double>(interior_mines) / problem_.interior : 0;
+    for (size_t i = 0; i < problem_.candidates.size(); ++i) {
+      const SamplingProblem::Candidate &candidate = problem_.candidates[i];
+      const double safe = candidate.variable >= 0 ? 1.0 - value_[candidate.variable] : 1.0 - interior_density;
+      if (safe <= 0.0) continue;
+      int revealed = 0;
+      for (int v : candidate.neighbor_variables) revealed += value_[v];
+      // Interior neighbours are drawn independently at the interior density of this sample
+      std::binomial_distribution<int> interior(candidate.interior_neighbors, interior_density);
+      revealed += interior(rng_);
+      totals.revealed[i * 9 + std::min(revealed, 8)] += safe;
+    }
+  }
+
+  const SamplingProblem &problem_;
+  std::mt19937_64 rng_;
+  std::vector<int> &touching_begin_;         // see Touching()
+  std::vector<int> &touching_;
+  std::vector<int> &linked_begin_;           // see Linked()
+  std::vector<int> &linked_;
+  std::vector<signed char> &value_;          // the current layout
+  std::vector<int> &sum_;                    // constraint -> mines of the current layout in it
+  int mines_ = 0;                            // frontier mines of the current layout
+  int outside_mines_ = 0;                    // frontier mines off the block being updated
+  long nodes_ = 0;                           // search nodes of the current block update
+  std::vector<int> &block_;
+  std::vector<bool> &in_block_;
+  std::vector<int> &open_;                   // constraint -> block variables not assigned yet
+  std::vector<int> &start_open_;             // constraint -> variables Start() has not assigned yet
+  std::vector<BlockSolution> &solutions_;
+  std::vector<double> &weights_;
+};
+
+}  // namespace sampler_detail
+
+// Storage of SampleLayouts(), kept by the caller so that a warm sampler runs without allocating
+struct SamplerScratch {
+  std::vector<sampler_detail::ChainStorage> chains;  // per chain; only the first chain count are in use
+  std::vector<double> revealed;
+};
+
+/**
+ * Sample layouts of the problem and estimate the probabilities and information gains described in SamplerResult,
+ * written to `result`.
+ */
+inline void SampleLayouts(const SamplingProblem &problem, const SamplerOptions &options, SamplerScratch &scratch,
+                          SamplerResult &result) {
+  const int threads =
+      options.threads > 0 ? options.threads : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  const int chains = options.chains > 0 ? options.chains : std::max(1, options.chains_per_thread) * threads;
+  struct Run {
+    const SamplingProblem &problem;
+    SamplerOptions options;
+    std::chrono::steady_clock::time_point deadline;
+    SamplerScratch &scratch;
+  } run{problem, options, {}, scratch};
+  if (run.options.time_budget_ms <= 0 && run.options.samples_per_chain == 0) run.options.samples_per_chain = 256;
+  run.deadline = std::chrono::steady_clock::now() +
+                 std::chrono::microseconds(static_cast<long>(run.options.time_budget_ms * 1000));
+  if (static_cast<int>(scratch.chains.size()) < chains) scratch.chains.resize(chains);
+  // The job captures one reference, so that std::function keeps it without allocating
+  ParallelFor(chains, threads, [&run](int i) {
+    sampler_detail::ChainStorage &storage = run.scratch.chains[i];
+    sampler_detail::ChainTotals &chain_totals = storage.totals;
+    chain_totals.samples = 0;
+    chain_totals.interior_mines = 0.0;
+    chain_totals.mines.assign(run.problem.variables, 0.0);
+    chain_totals.revealed.assign(run.problem.candidates.size() * 9, 0.0);
+    // Chains queued behind others (e.g. run serially inside a batch of parallel games) may find the budget spent
+    if (run.options.time_budget_ms > 0 && std::chrono::steady_clock::now() >= run.deadline) return;
+    sampler_detail::Chain chain(run.problem, run.options.seed * 0x9E3779B97F4A7C15ull + static_cast<uint64_t>(i) + 1,
+                                storage);
+    if (chain.Start()) chain.Run(chain_totals, run.options, run.deadline);
+  });
+  result.samples = 0;
+  result.interior_probability = 0.0;
+  result.mine_probability.assign(problem.variables, 0.0);
+  result.safe_probability.assign(problem.candidates.size(), 0.0);
+  result.information_gain.assign(problem.candidates.size(), 0.0);
+  std::vector<double> &revealed = scratch.revealed;
+  revealed.assign(problem.candidates.size() * 9, 0.0);
+  double interior_mines = 0.0;
+  for (int i = 0; i < chains; ++i) {
+    const sampler_detail::ChainTotals &chain_totals = scratch.chains[i].totals;
+    if (chain_totals.samples == 0) continue;
+    result.samples += chain_totals.samples;
+    for (int v = 0; v < problem.variables; ++v) result.mine_probability[v] += chain_totals.mines[v];
+    for (size_t j = 0; j < revealed.size(); ++j) revealed[j] += chain_totals.revealed[j];
+    interior_mines += chain_totals.interior_mines;
+  }
+  if (result.samples == 0) return;
+  for (double &p : result.mine_probability) p /= result.samples;
+  if (problem.interior > 0) result.interior_probability = interior_mines / result.samples / problem.interior;
+  for (size_t i = 0; i < problem.candidates.size(); ++i) {
+    double safe = 0.0;
+    for (int n = 0; n < 9; ++n) safe += revealed[i * 9 + n];
+    result.safe_probability[i] = safe / result.samples;
+    if (safe <= 0.0) continue;
+    for (int n = 0; n < 9; ++n) {
+      const double p = revealed[i * 9 + n] / safe;
+      if (p > 0.0) result.information_gain[i] -= p * std::log2(p);
+    }
+  }
+}
+
+#endif
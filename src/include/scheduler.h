@@ -0,0 +1,174 @@
+/**
+ * A small work-stealing scheduler for running many independent jobs (e.g. batch games) on every core.
+ *
+ * The jobs run on one process-wide pool of threads that is started on first use and only grows, so a parallel loop
+ * costs a wake-up rather than a thread start. A parallel loop started from inside a job of another one runs serially on
+ * the calling thread: the outer loop already keeps every core busy, and nested loops (e.g. the Monte Carlo sampler
+ * inside a batch of parallel games) must not oversubscribe them.
+ */
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkerPool {
+ public:
+  // The pool every ParallelFor() call runs on
+  static WorkerPool &Shared() {
+    static WorkerPool pool;
+    return pool;
+  }
+
+  WorkerPool() = default;
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  ~WorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto &thread : threads_) thread.join();
+  }
+
+  /**
+   * Run job(0, worker), ..., job(count - 1, worker) on `threads` threads, the calling one included, and return when
+   * all of them have finished. See ParallelForWithWorker().
+   */
+  void Run(int count, int threads, const std::function<void(int, int)> &job) {
+    if (threads <= 1 || count <= 1 || InJob()) {
+      for (int i = 0; i < count; ++i) job(i, 0);
+      return;
+    }
+    threads = std::min(threads, count);
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+    while (static_cast<int>(queues_.size()) < threads) queues_.push_back(std::make_unique<WorkQueue>());
+    while (static_cast<int>(threads_.size()) < threads - 1) {
+      const int self = static_cast<int>(threads_.size()) + 1;
+      threads_.emplace_back([this, self] { Serve(self); });
+    }
+    for (int t = 0; t < threads; ++t) {
+      const int begin = static_cast<int>(static_cast<long long>(count) * t / threads);
+      const int end = static_cast<int>(static_cast<long long>(count) * (t + 1) / threads);
+      WorkQueue &queue = *queues_[t];
+      queue.jobs.clear();
+      queue.head = 0;
+      for (int i = begin; i < end; ++i) queue.jobs.push_back(i);
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      job_ = &job;
+      participants_ = threads;
+      running_ = threads - 1;
+      ++generation_;
+    }
+    wake_.notify_all();
+    Work(0);
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return running_ == 0; });
+    job_ = nullptr;
+  }
+
+ private:
+  // jobs[head, size) are still waiting; the owner takes from the back and thieves from the front, so a run reuses the
+  // storage of the previous one
+  struct WorkQueue {
+    std::mutex mutex;
+    std::vector<int> jobs;
+    size_t head = 0;
+  };
+
+  // Whether the calling thread is running a job of some pool
+  static bool &InJob() {
+    thread_local bool in_job = false;
+    return in_job;
+  }
+
+  // Loop of background thread `self`: take part in every run that has a place for it
+  void Serve(int self) {
+    uint64_t served = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      wake_.wait(lock, [&] { return stopping_ || generation_ != served; });
+      if (stopping_) return;
+      served = generation_;
+      if (self >= participants_) continue;
+      lock.unlock();
+      Work(self);
+      lock.lock();
+      if (--running_ == 0) done_.notify_all();
+    }
+  }
+
+  void Work(int self) {
+    InJob() = true;
+    int index;
+    while (Take(self, index)) (*job_)(index, self);
+    InJob() = false;
+  }
+
+  /**
+   * Each participant starts with a contiguous block of indices in its own queue and takes work from the back of it.
+   * Once its queue runs dry it steals from the front of the other participants' queues, so uneven job lengths do not
+   * leave cores idle.
+   */
+  bool Take(int self, int &index) {
+    {
+      WorkQueue &home = *queues_[self];
+      std::lock_guard<std::mutex> lock(home.mutex);
+      if (home.head < home.jobs.size()) {
+        index = home.jobs.back();
+        home.jobs.pop_back();
+        return true;
+      }
+    }
+    // Nothing left at home: steal the oldest job of another participant. No jobs are ever added during a run, so a
+    // full round of empty queues means everything has been handed out.
+    for (int k = 1; k < participants_; ++k) {
+      WorkQueue &victim = *queues_[(self + k) % participants_];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (victim.head < victim.jobs.size()) {
+        index = victim.jobs[victim.head++];
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::mutex run_mutex_;  // one run at a time
+  std::mutex mutex_;      // guards the fields below, which hand a run to the background threads
+  std::condition_variable wake_, done_;
+  std::vector<std::thread> threads_;                // background thread t takes part as participant t + 1
+  std::vector<std::unique_ptr<WorkQueue>> queues_;  // per participant
+  const std::function<void(int, int)> *job_ = nullptr;
+  int participants_ = 0;
+  int running_ = 0;  // background participants still working on the current run
+  uint64_t generation_ = 0;
+  bool stopping_ = false;
+};
+
+/**
+ * Run job(0, worker), ..., job(count - 1, worker) on `threads` threads of the shared WorkerPool and return when all of
+ * them have finished. `worker` (in [0, threads)) names the thread running the job, so that jobs can reuse per-thread
+ * state. Jobs must be independent of each other; the order they run in is unspecified.
+ */
+inline void ParallelForWithWorker(int count, int threads, const std::function<void(int, int)> &job) {
+  WorkerPool::Shared().Run(count, threads, job);
+}
+
+/**
+ * Run job(0), ..., job(count - 1) on `threads` threads (see ParallelForWithWorker()).
+ */
+inline void ParallelFor(int count, int threads, const std::function<void(int)> &job) {
+  ParallelForWithWorker(count, threads, [&job](int index, int) { job(index); });
+}
+
+#endif
@@ -1,10 +1,16 @@
 #ifndef SERVER_H
 #define SERVER_H
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <string>
 #include <vector>
-#include <queue>
+
+#include "adjacency.h"
+#include "board.h"
+#include "profile.h"
 
 /*
  * You may need to define some global variables for the information of the game map here.
@@ -18,62 +24,401 @@ int total_mines;  // The count of mines of the game map. You MUST NOT modify its
                   // variable in function InitMap. It will be used in the advanced task.
 int game_state;  // The state of the game, 0 for continuing, 1 for winning, -1 for losing. You MUST NOT modify its name.
 
-// Internal game state
-static std::vector<std::vector<bool>> mine_grid;         // true if mine
-static std::vector<std::vector<int>> adjacent_mines;     // number of adjacent mines
-static std::vector<std::vector<bool>> visited_grid;      // visited status
-static std::vector<std::vector<bool>> marked_grid;       // marked status
-static int visited_non_mine_count = 0;                   // number of visited non-mine cells
-static int marked_correct_mines_count = 0;               // number of correctly marked mines
+/**
+ * One game on the server side. All the state of a game lives in the instance, so independent games can be played side
+ * by side (see TestBatchParallel() in advanced.cpp). The global functions below drive a default instance and mirror its
+ * dimensions and state into rows, columns, total_mines and game_state.
+ *
+ * Every plane is a bitboard holding words_per_row_ 64-bit words per row, bit (c % 64) of word (c / 64) standing for
+ * column c. Bits beyond the last column are always zero.
+ */
+class GameServer {
+ public:
+  void InitMap(std::istream &in);
+  void InitMap(int rows, int columns, const uint8_t *mines);
+  void InitMapPacked(int rows, int columns, const uint64_t *packed_mines);
+  void PackMines(uint64_t *packed_mines) const;
+  void VisitBlock(int r, int c);
+  void MarkMine(int r, int c);
+  void AutoExplore(int r, int c);
+  void PrintMap(std::ostream &out) const;
+  const char *RenderedMap() const { return rendered_map_.data(); }
+
+  int rows() const { return rows_; }
+  int columns() const { return columns_; }
+  int total_mines() const { return total_mines_; }
+  int game_state() const { return game_state_; }
+  int visited_non_mine_count() const { return visited_non_mine_count_; }
+  int marked_correct_mines_count() const { return marked_correct_mines_count_; }
+
+ private:
+  static constexpr int kWordBits = 64;
+
+  void ResetBoard(int rows, int columns);
+  void ComputeAdjacency();
+  bool InBounds(int r, int c) const;
+  size_t BitWordIndex(int r, int c) const;
+  bool TestBit(const std::vector<uint64_t> &plane, int r, int c) const;
+  void SetBit(std::vector<uint64_t> &plane, int r, int c);
+  static uint64_t SpreadRowWord(const uint64_t *row, int w, int words);
+  char &RenderedCell(int r, int c);
+  void RenderDigit(int r, int c);
+  void RenderDigitWord(int r, int w, uint64_t bits);
+  void RecomputeGameWinState();
+  void FloodVisitFrom(int r0, int c0);
+  template <typename Geometry>
+  void FloodZeroRegion(const Geometry &board, int r0, int c0);
+
+  int rows_ = 0;
+  int columns_ = 0;
+  int total_mines_ = 0;
+  int game_state_ = 0;                              // 0 for continuing, 1 for winning, -1 for losing
+  int words_per_row_ = 0;                           // 64-bit words per bitboard row
+  std::vector<uint64_t> mine_bits_;                 // set if mine
+  std::vector<uint64_t> visited_bits_;              // visited status
+  std::vector<uint64_t> marked_bits_;               // marked status
+  std::vector<uint64_t> zero_bits_;                 // set if non-mine with no adjacent mines
+  std::vector<uint64_t> column_mask_;               // one row of valid columns
+  std::vector<uint64_t> flood_front_;               // flood fill scratch: zero cells reached last round
+  std::vector<uint64_t> flood_next_;                // flood fill scratch: zero cells reached this round
+  std::vector<uint8_t> mine_bytes_;                 // mines as bytes, padded by one cell on every side
+  std::vector<uint8_t> adjacent_mines_;             // number of adjacent mines, row-major
+  int visited_non_mine_count_ = 0;                  // number of visited non-mine cells
+  int marked_correct_mines_count_ = 0;              // number of correctly marked mines
+  std::string rendered_map_;                        // the frame PrintMap() writes, kept up to date by each move
+};
+
+inline bool GameServer::InBounds(int r, int c) const {
+  return r >= 0 && r < rows_ && c >= 0 && c < columns_;
+}
 
-static inline bool InBounds(int r, int c) {
-  return r >= 0 && r < rows && c >= 0 && c < columns;
+inline size_t GameServer::BitWordIndex(int r, int c) const {
+  return static_cast<size_t>(r) * words_per_row_ + c / kWordBits;
 }
 
-static inline void RecomputeGameWinState() {
-  const int total_non_mines = rows * columns - total_mines;
-  if (visited_non_mine_count == total_non_mines) {
-    game_state = 1;
+inline bool GameServer::TestBit(const std::vector<uint64_t> &plane, int r, int c) const {
+  return (plane[BitWordIndex(r, c)] >> (c % kWordBits)) & 1u;
+}
+
+inline void GameServer::SetBit(std::vector<uint64_t> &plane, int r, int c) {
+  plane[BitWordIndex(r, c)] |= uint64_t{1} << (c % kWordBits);
+}
+
+/**
+ * Horizontal part of the 8-way dilation: word w of a row of `words` words OR'ed with its left and right shifts,
+ * carrying the edge bits across neighbouring words of the same row.
+ */
+inline uint64_t GameServer::SpreadRowWord(const uint64_t *row, int w, int words) {
+  uint64_t x = row[w];
+  uint64_t spread = x | (x << 1) | (x >> 1);
+  if (w > 0) spread |= row[w - 1] >> (kWordBits - 1);
+  if (w + 1 < words) spread |= row[w + 1] << (kWordBits - 1);
+  return spread;
+}
+
+inline char &GameServer::RenderedCell(int r, int c) {
+  return rendered_map_[static_cast<size_t>(r) * (columns_ + 1) + c];
+}
+
+inline void GameServer::RenderDigit(int r, int c) {
+  RenderedCell(r, c) = static_cast<char>('0' + adjacent_mines_[static_cast<size_t>(r) * columns_ + c]);
+}
+
+/**
+ * Patch the digits of every cell set in the given word of a freshly visited bitboard row.
+ */
+inline void GameServer::RenderDigitWord(int r, int w, uint64_t bits) {
+  while (bits != 0) {
+    RenderDigit(r, w * kWordBits + __builtin_ctzll(bits));
+    bits &= bits - 1;
   }
 }
 
-static void FloodVisitFrom(int r0, int c0) {
-  // Visit a non-mine cell; expand if zero using BFS
-  std::queue<std::pair<int, int>> bfs_queue;
-  auto try_visit = [&](int r, int c) {
-    if (!InBounds(r, c)) return;
-    if (mine_grid[r][c]) return;          // never visit mines here
-    if (visited_grid[r][c]) return;
-    if (marked_grid[r][c]) return;        // marked cells are not auto-visited
-    visited_grid[r][c] = true;
-    ++visited_non_mine_count;
-    if (adjacent_mines[r][c] == 0) {
-      bfs_queue.emplace(r, c);
-    }
-  };
-
-  try_visit(r0, c0);
-  while (!bfs_queue.empty()) {
-    auto [r, c] = bfs_queue.front();
-    bfs_queue.pop();
-    static const int dr[8] = {-1,-1,-1,0,0,1,1,1};
-    static const int dc[8] = {-1,0,1,-1,1,-1,0,1};
-    for (int k = 0; k < 8; ++k) {
-      int nr = r + dr[k], nc = c + dc[k];
-      if (!InBounds(nr, nc)) continue;
-      if (mine_grid[nr][nc]) continue;
-      if (visited_grid[nr][nc]) continue;
-      if (marked_grid[nr][nc]) continue;
-      visited_grid[nr][nc] = true;
-      ++visited_non_mine_count;
-      if (adjacent_mines[nr][nc] == 0) {
-        bfs_queue.emplace(nr, nc);
+inline void GameServer::RecomputeGameWinState() {
+  const int total_non_mines = rows_ * columns_ - total_mines_;
+  if (visited_non_mine_count_ == total_non_mines) {
+    game_state_ = 1;
+    // Victory: reveal all mines as '@', every other cell already shows its digit
+    for (int r = 0; r < rows_; ++r) {
+      for (int w = 0; w < words_per_row_; ++w) {
+        uint64_t bits = mine_bits_[static_cast<size_t>(r) * words_per_row_ + w];
+        while (bits != 0) {
+          RenderedCell(r, w * kWordBits + __builtin_ctzll(bits)) = '@';
+          bits &= bits - 1;
+        }
       }
     }
   }
+}
+
+inline void GameServer::FloodVisitFrom(int r0, int c0) {
+  // Visit a non-mine cell; expand if zero by repeated 8-way dilation of the newly reached zero cells, masked by the
+  // cells that may still be opened (non-mine, unvisited, unmarked; see FloodZeroRegion())
+  PROFILE_SCOPE(kTimeFloodVisit);
+  if (TestBit(mine_bits_, r0, c0)) return;     // never visit mines here
+  if (TestBit(visited_bits_, r0, c0)) return;
+  if (TestBit(marked_bits_, r0, c0)) return;   // marked cells are not auto-visited
+  SetBit(visited_bits_, r0, c0);
+  ++visited_non_mine_count_;
+  PROFILE_COUNT(kCountFloods, 1);
+  PROFILE_COUNT(kCountCellsRevealed, 1);
+  RenderDigit(r0, c0);
+  if (TestBit(zero_bits_, r0, c0)) {
+    WithBoard(rows_, columns_, [&](const auto &board) { FloodZeroRegion(board, r0, c0); });
+  }
   RecomputeGameWinState();
 }
 
+/**
+ * Open the region reachable from the zero cell (r0, c0), already visited, by repeated 8-way dilation of the newly
+ * reached zero cells. Instantiated per common board size (see board.h): with one word per row on those boards, the
+ * word loops and edge carries fold away.
+ */
+template <typename Geometry>
+inline void GameServer::FloodZeroRegion(const Geometry &board, int r0, int c0) {
+  const int rows = board.rows();
+  const int words = board.words_per_row();
+  SetBit(flood_front_, r0, c0);
+  int lo = r0, hi = r0;  // rows of flood_front_ that may be non-zero
+  while (lo <= hi) {
+    int next_lo = rows, next_hi = -1;
+    const int from = lo > 0 ? lo - 1 : 0;
+    const int to = hi + 1 < rows ? hi + 1 : rows - 1;
+    for (int r = from; r <= to; ++r) {
+      const size_t base = static_cast<size_t>(r) * words;
+      bool has_next = false;
+      for (int w = 0; w < words; ++w) {
+        uint64_t reach = 0;
+        if (r - 1 >= lo) reach |= SpreadRowWord(&flood_front_[base - words], w, words);
+        if (r >= lo && r <= hi) reach |= SpreadRowWord(&flood_front_[base], w, words);
+        if (r + 1 <= hi) reach |= SpreadRowWord(&flood_front_[base + words], w, words);
+        const uint64_t grow =
+            reach & column_mask_[w] & ~mine_bits_[base + w] & ~visited_bits_[base + w] & ~marked_bits_[base + w];
+        if (grow == 0) continue;
+        visited_bits_[base + w] |= grow;
+        visited_non_mine_count_ += __builtin_popcountll(grow);
+        PROFILE_COUNT(kCountCellsRevealed, __builtin_popcountll(grow));
+        RenderDigitWord(r, w, grow);
+        flood_next_[base + w] = grow & zero_bits_[base + w];
+        has_next |= flood_next_[base + w] != 0;
+      }
+      if (has_next) {
+        if (r < next_lo) next_lo = r;
+        next_hi = r;
+      }
+    }
+    for (int r = lo; r <= hi; ++r) {
+      for (int w = 0; w < words; ++w) flood_front_[static_cast<size_t>(r) * words + w] = 0;
+    }
+    flood_front_.swap(flood_next_);
+    lo = next_lo;
+    hi = next_hi;
+  }
+}
+
+/**
+ * Size every plane for a rows x columns board with no mines and nothing visited.
+ */
+inline void GameServer::ResetBoard(int rows, int columns) {
+  rows_ = rows;
+  columns_ = columns;
+  words_per_row_ = (columns_ + kWordBits - 1) / kWordBits;
+  const size_t plane_words = static_cast<size_t>(rows_) * words_per_row_;
+  mine_bits_.assign(plane_words, 0);
+  visited_bits_.assign(plane_words, 0);
+  marked_bits_.assign(plane_words, 0);
+  zero_bits_.assign(plane_words, 0);
+  flood_front_.assign(plane_words, 0);
+  flood_next_.assign(plane_words, 0);
+  column_mask_.assign(words_per_row_, ~uint64_t{0});
+  if (columns_ % kWordBits != 0) {
+    column_mask_[words_per_row_ - 1] = (uint64_t{1} << (columns_ % kWordBits)) - 1;
+  }
+  adjacent_mines_.assign(static_cast<size_t>(rows_) * columns_, 0);
+  rendered_map_.assign(static_cast<size_t>(rows_) * (columns_ + 1), '?');
+  for (int i = 0; i < rows_; ++i) {
+    RenderedCell(i, columns_) = '\n';
+  }
+  visited_non_mine_count_ = 0;
+  marked_correct_mines_count_ = 0;
+  total_mines_ = 0;
+  game_state_ = 0;
+}
+
+/**
+ * Precompute adjacent mine counts and the zero plane once the mine plane is filled in.
+ */
+inline void GameServer::ComputeAdjacency() {
+  // Spread the mine bits into the padded byte plane, then box-sum it row by row (see adjacency.h)
+  const size_t stride = static_cast<size_t>(columns_) + 2;
+  mine_bytes_.assign((static_cast<size_t>(rows_) + 2) * stride, 0);
+  for (int r = 0; r < rows_; ++r) {
+    for (int w = 0; w < words_per_row_; ++w) {
+      for (uint64_t bits = mine_bits_[static_cast<size_t>(r) * words_per_row_ + w]; bits != 0; bits &= bits - 1) {
+        mine_bytes_[(r + 1) * stride + w * kWordBits + __builtin_ctzll(bits) + 1] = 1;
+      }
+    }
+  }
+  const AdjacencyRowFunction count_row = AdjacencyRowKernel();
+  for (int r = 0; r < rows_; ++r) {
+    const uint8_t *above = &mine_bytes_[r * stride];
+    count_row(above, above + stride, above + 2 * stride, columns_, &adjacent_mines_[static_cast<size_t>(r) * columns_],
+              &zero_bits_[static_cast<size_t>(r) * words_per_row_]);
+  }
+}
+
+/**
+ * Read a map in the format of InitMap() from the given stream and start a new game on it.
+ */
+inline void GameServer::InitMap(std::istream &in) {
+  int rows, columns;
+  in >> rows >> columns;
+  ResetBoard(rows, columns);
+  // Read map lines
+  for (int i = 0; i < rows_; ++i) {
+    for (int j = 0; j < columns_; ++j) {
+      char ch;
+      in >> ch;
+      if (ch == 'X') {
+        SetBit(mine_bits_, i, j);
+        ++total_mines_;
+      }
+    }
+  }
+  ComputeAdjacency();
+}
+
+/**
+ * Start a new game on a map held in memory: rows * columns flags in row-major order, non-zero for a mine.
+ */
+inline void GameServer::InitMap(int rows, int columns, const uint8_t *mines) {
+  ResetBoard(rows, columns);
+  for (int i = 0; i < rows_; ++i) {
+    for (int j = 0; j < columns_; ++j) {
+      if (mines[static_cast<size_t>(i) * columns_ + j]) {
+        SetBit(mine_bits_, i, j);
+        ++total_mines_;
+      }
+    }
+  }
+  ComputeAdjacency();
+}
+
+/**
+ * Start a new game on a packed row-major mine bitset: cell (i, j) is bit (k % 64) of word k / 64, k = i * columns + j.
+ * Rows are moved into the bit planes a word at a time, so a map costs O(rows * columns / 64) before the adjacency pass.
+ */
+inline void GameServer::InitMapPacked(int rows, int columns, const uint64_t *packed_mines) {
+  ResetBoard(rows, columns);
+  for (int i = 0; i < rows_; ++i) {
+    const size_t row_bit = static_cast<size_t>(i) * columns_;
+    for (int w = 0; w < words_per_row_; ++w) {
+      const size_t bit = row_bit + static_cast<size_t>(w) * kWordBits;
+      const int shift = static_cast<int>(bit % kWordBits);
+      uint64_t word = packed_mines[bit / kWordBits] >> shift;
+      const int remaining = columns_ - w * kWordBits;
+      if (shift != 0 && remaining > kWordBits - shift) word |= packed_mines[bit / kWordBits + 1] << (kWordBits - shift);
+      word &= column_mask_[w];
+      mine_bits_[static_cast<size_t>(i) * words_per_row_ + w] = word;
+      total_mines_ += __builtin_popcountll(word);
+    }
+  }
+  ComputeAdjacency();
+}
+
+/**
+ * Write the mines of the current map in the layout read by InitMapPacked(). `packed_mines` must hold
+ * (rows * columns + 63) / 64 words.
+ */
+inline void GameServer::PackMines(uint64_t *packed_mines) const {
+  std::fill(packed_mines, packed_mines + (static_cast<size_t>(rows_) * columns_ + kWordBits - 1) / kWordBits, 0);
+  for (int i = 0; i < rows_; ++i) {
+    for (int w = 0; w < words_per_row_; ++w) {
+      for (uint64_t bits = mine_bits_[static_cast<size_t>(i) * words_per_row_ + w]; bits != 0; bits &= bits - 1) {
+        const size_t k = static_cast<size_t>(i) * columns_ + w * kWordBits + __builtin_ctzll(bits);
+        packed_mines[k / kWordBits] |= uint64_t{1} << (k % kWordBits);
+      }
+    }
+  }
+}
+
+inline void GameServer::VisitBlock(int r, int c) {
+  PROFILE_SCOPE(kTimeVisitBlock);
+  if (game_state_ != 0) return;  // game already ended
+  if (!InBounds(r, c)) return;  // invalid operation
+  if (TestBit(visited_bits_, r, c)) return;  // already visited
+  if (TestBit(marked_bits_, r, c)) return;  // marked has no effect
+  if (TestBit(mine_bits_, r, c)) {
+    // Visiting a mine ends the game immediately
+    SetBit(visited_bits_, r, c);
+    RenderedCell(r, c) = 'X';
+    game_state_ = -1;
+    return;
+  }
+  FloodVisitFrom(r, c);
+}
+
+inline void GameServer::MarkMine(int r, int c) {
+  PROFILE_SCOPE(kTimeMarkMine);
+  if (game_state_ != 0) return;  // game already ended
+  if (!InBounds(r, c)) return;  // invalid operation
+  if (TestBit(visited_bits_, r, c)) return;  // already visited -> no effect
+  if (TestBit(marked_bits_, r, c)) return;  // already marked -> no effect
+
+  if (TestBit(mine_bits_, r, c)) {
+    SetBit(marked_bits_, r, c);
+    RenderedCell(r, c) = '@';
+    ++marked_correct_mines_count_;
+    // marking does not change win condition directly
+  } else {
+    // Marking a non-mine causes immediate failure
+    SetBit(marked_bits_, r, c);
+    RenderedCell(r, c) = 'X';  // wrong mark appears as X
+    game_state_ = -1;
+  }
+}
+
+inline void GameServer::AutoExplore(int r, int c) {
+  PROFILE_SCOPE(kTimeAutoExplore);
+  if (game_state_ != 0) return;
+  if (!InBounds(r, c)) return;
+  if (!TestBit(visited_bits_, r, c)) return;  // only for visited non-mine cells
+  if (TestBit(mine_bits_, r, c)) return;
+
+  // Count marked neighbors and compare with the number on this cell
+  int required = adjacent_mines_[static_cast<size_t>(r) * columns_ + c];
+  int marked_neighbors = 0;
+  const RuntimeBoard board{rows_, columns_};
+  board.ForEachNeighbor(r, c, [&](int nr, int nc) { marked_neighbors += TestBit(marked_bits_, nr, nc); });
+  if (marked_neighbors != required) return;  // not eligible
+
+  // Visit all non-mine neighbors (not marked, not visited)
+  board.ForEachNeighbor(r, c, [&](int nr, int nc) {
+    if (game_state_ != 0) return;  // may win here
+    if (TestBit(mine_bits_, nr, nc)) return;
+    if (TestBit(visited_bits_, nr, nc)) return;
+    if (TestBit(marked_bits_, nr, nc)) return;
+    FloodVisitFrom(nr, nc);
+  });
+}
+
+inline void GameServer::PrintMap(std::ostream &out) const {
+  // The frame is patched in place by every move, so printing it is a single write
+  PROFILE_SCOPE(kTimePrintMap);
+  out.write(rendered_map_.data(), static_cast<std::streamsize>(rendered_map_.size()));
+  out.flush();
+}
+
+// The game behind the global interface below
+static GameServer default_server;
+
+static inline void SyncGlobalState() {
+  rows = default_server.rows();
+  columns = default_server.columns();
+  total_mines = default_server.total_mines();
+  game_state = default_server.game_state();
+}
+
 /**
  * @brief The definition of function InitMap()
  *
@@ -87,39 +432,8 @@ static void FloodVisitFrom(int r0, int c0) {
  * would be initialized, with all the blocks unvisited.
  */
 void InitMap() {
-  std::cin >> rows >> columns;
-  mine_grid.assign(rows, std::vector<bool>(columns, false));
-  adjacent_mines.assign(rows, std::vector<int>(columns, 0));
-  visited_grid.assign(rows, std::vector<bool>(columns, false));
-  marked_grid.assign(rows, std::vector<bool>(columns, false));
-  visited_non_mine_count = 0;
-  marked_correct_mines_count = 0;
-  total_mines = 0;
-  game_state = 0;
-
-  // Read map lines
-  for (int i = 0; i < rows; ++i) {
-    for (int j = 0; j < columns; ++j) {
-      char ch;
-      std::cin >> ch;
-      mine_grid[i][j] = (ch == 'X');
-      if (mine_grid[i][j]) ++total_mines;
-    }
-  }
-
-  // Precompute adjacent mine counts
-  static const int dr[8] = {-1,-1,-1,0,0,1,1,1};
-  static const int dc[8] = {-1,0,1,-1,1,-1,0,1};
-  for (int i = 0; i < rows; ++i) {
-    for (int j = 0; j < columns; ++j) {
-      int cnt = 0;
-      for (int k = 0; k < 8; ++k) {
-        int ni = i + dr[k], nj = j + dc[k];
-        if (InBounds(ni, nj) && mine_grid[ni][nj]) ++cnt;
-      }
-      adjacent_mines[i][j] = cnt;
-    }
-  }
+  default_server.InitMap(std::cin);
+  SyncGlobalState();
 }
 
 /**
@@ -153,17 +467,8 @@ void InitMap() {
  * @note For invalid operation, you should not do anything.
  */
 void VisitBlock(int r, int c) {
-  if (game_state != 0) return;          // game already ended
-  if (!InBounds(r, c)) return;          // invalid operation
-  if (visited_grid[r][c]) return;       // already visited
-  if (marked_grid[r][c]) return;        // marked has no effect
-  if (mine_grid[r][c]) {
-    // Visiting a mine ends the game immediately
-    visited_grid[r][c] = true;
-    game_state = -1;
-    return;
-  }
-  FloodVisitFrom(r, c);
+  default_server.VisitBlock(r, c);
+  SyncGlobalState();
 }
 
 /**
@@ -200,20 +505,8 @@ void VisitBlock(int r, int c) {
  * @note For invalid operation, you should not do anything.
  */
 void MarkMine(int r, int c) {
-  if (game_state != 0) return;          // game already ended
-  if (!InBounds(r, c)) return;          // invalid operation
-  if (visited_grid[r][c]) return;       // already visited -> no effect
-  if (marked_grid[r][c]) return;        // already marked -> no effect
-
-  if (mine_grid[r][c]) {
-    marked_grid[r][c] = true;
-    ++marked_correct_mines_count;
-    // marking does not change win condition directly
-  } else {
-    // Marking a non-mine causes immediate failure
-    marked_grid[r][c] = true; // keep for rendering 'X'
-    game_state = -1;
-  }
+  default_server.MarkMine(r, c);
+  SyncGlobalState();
 }
 
 /**
@@ -233,33 +526,8 @@ void MarkMine(int r, int c) {
  * And the game ends (and player wins).
  */
 void AutoExplore(int r, int c) {
-  if (game_state != 0) return;
-  if (!InBounds(r, c)) return;
-  if (!visited_grid[r][c]) return;      // only for visited non-mine cells
-  if (mine_grid[r][c]) return;
-
-  // Count marked neighbors and compare with the number on this cell
-  int required = adjacent_mines[r][c];
-  int marked_neighbors = 0;
-  static const int dr[8] = {-1,-1,-1,0,0,1,1,1};
-  static const int dc[8] = {-1,0,1,-1,1,-1,0,1};
-  for (int k = 0; k < 8; ++k) {
-    int nr = r + dr[k], nc = c + dc[k];
-    if (!InBounds(nr, nc)) continue;
-    if (marked_grid[nr][nc]) ++marked_neighbors;
-  }
-  if (marked_neighbors != required) return;  // not eligible
-
-  // Visit all non-mine neighbors (not marked, not visited)
-  for (int k = 0; k < 8; ++k) {
-    int nr = r + dr[k], nc = c + dc[k];
-    if (!InBounds(nr, nc)) continue;
-    if (mine_grid[nr][nc]) continue;
-    if (visited_grid[nr][nc]) continue;
-    if (marked_grid[nr][nc]) continue;
-    FloodVisitFrom(nr, nc);
-    if (game_state != 0) return;  // may win here
-  }
+  default_server.AutoExplore(r, c);
+  SyncGlobalState();
 }
 
 /**
@@ -274,15 +542,18 @@ void AutoExplore(int r, int c) {
 void ExitGame() {
   if (game_state == 1) {
     std::cout << "YOU WIN!" << std::endl;
-    std::cout << visited_non_mine_count << " " << total_mines << std::endl;
+    std::cout << default_server.visited_non_mine_count() << " " << total_mines << std::endl;
   } else if (game_state == -1) {
     std::cout << "GAME OVER!" << std::endl;
-    std::cout << visited_non_mine_count << " " << marked_correct_mines_count << std::endl;
+    std::cout << default_server.visited_non_mine_count() << " " << default_server.marked_correct_mines_count()
+              << std::endl;
   } else {
     // Should not happen in normal flow, but keep a fallback
     std::cout << "GAME OVER!" << std::endl;
-    std::cout << visited_non_mine_count << " " << marked_correct_mines_count << std::endl;
+    std::cout << default_server.visited_non_mine_count() << " " << default_server.marked_correct_mines_count()
+              << std::endl;
   }
+  ProfileReport();
   exit(0);  // Exit the game immediately
 }
 
@@ -311,39 +582,18 @@ void ExitGame() {
  * @note Use std::cout to print the game map, especially when you want to try the advanced task!!!
  */
 void PrintMap() {
-  for (int i = 0; i < rows; ++i) {
-    for (int j = 0; j < columns; ++j) {
-      char out_char = '?';
-      if (game_state == 1) {
-        // Victory: reveal all mines as '@', others are their digits
-        if (mine_grid[i][j]) {
-          out_char = '@';
-        } else {
-          out_char = static_cast<char>('0' + adjacent_mines[i][j]);
-        }
-      } else {
-        // Ongoing or failure
-        if (visited_grid[i][j]) {
-          if (mine_grid[i][j]) {
-            out_char = 'X';
-          } else {
-            out_char = static_cast<char>('0' + adjacent_mines[i][j]);
-          }
-        } else if (marked_grid[i][j]) {
-          // Marked but not visited
-          if (mine_grid[i][j]) {
-            out_char = '@';
-          } else {
-            out_char = 'X';  // wrong mark appears as X
-          }
-        } else {
-          out_char = '?';
-        }
-      }
-      std::cout << out_char;
-    }
-    std::cout << std::endl;
-  }
+  default_server.PrintMap(std::cout);
+}
+
+/**
+ * @brief The definition of function RenderedMap()
+ *
+ * @details This function gives a read-only view of the frame PrintMap() would print: rows lines of columns characters,
+ * each followed by '\n'. The view stays valid until the next InitMap() and always reflects the latest move, so an
+ * in-process client can read the board without going through std::cout.
+ */
+const char *RenderedMap() {
+  return default_server.RenderedMap();
 }
 
 #endif
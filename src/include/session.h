@@ -0,0 +1,115 @@
+/**
+ * A self-contained game: one GameServer played by one player, with no global state involved. Sessions are what the
+ * parallel batch runner and the benchmark hand to their worker threads. A session plays any number of games in turn,
+ * and each game resets the server and the player in place, so a worker that keeps its session stops allocating once
+ * both have seen its largest board.
+ */
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <chrono>
+#include <cstdint>
+#include <istream>
+#include <utility>
+#include <vector>
+
+#include "corpus.h"
+#include "game_client.h"
+#include "generator.h"
+#include "server.h"
+
+/**
+ * The outcome of one game, with the same two numbers ExitGame() prints.
+ */
+struct GameResult {
+  int game_state = 0;         // 1 for winning, -1 for losing
+  int visit_count = 0;        // visited non-mine grids
+  int marked_mine_count = 0;  // correctly marked mines, or all mines after a win
+  int decisions = 0;          // calls to Decide()
+  int guesses = 0;            // decisions that had to guess
+};
+
+/**
+ * Plays games of a GameServer with a Player. A Player is any strategy with the interface of GameClient:
+ *   - a constructor taking a GameClient::Executor (plus whatever arguments are passed on to the session),
+ *   - InitGame(rows, columns, total_mines, first_row, first_column), ReadMapView(frame) and Decide(),
+ *   - guess_count(), the number of decisions of the current game that were guesses.
+ */
+template <typename Player = GameClient>
+class GameSession {
+ public:
+  template <typename... PlayerArgs>
+  explicit GameSession(PlayerArgs &&...player_args)
+      : player_([this](int r, int c, int type) { Execute(r, c, type); }, std::forward<PlayerArgs>(player_args)...) {}
+  GameSession(const GameSession &) = delete;
+  GameSession &operator=(const GameSession &) = delete;
+
+  /**
+   * Play a whole game on a map in the format read by InitMap() followed by the first move, as GenerateMap() prints it.
+   * If decision_latencies is given, the wall time of every Decide() call is appended to it in nanoseconds.
+   */
+  GameResult Play(std::istream &in, std::vector<uint32_t> *decision_latencies = nullptr) {
+    server_.InitMap(in);
+    int first_row, first_column;
+    in >> first_row >> first_column;
+    return PlayFrom(first_row, first_column, decision_latencies);
+  }
+
+  /**
+   * Play a whole game on a map handed over in memory, skipping the text format altogether.
+   */
+  GameResult Play(const GeneratedMap &map, std::vector<uint32_t> *decision_latencies = nullptr) {
+    server_.InitMap(map.rows, map.columns, map.mines.data());
+    return PlayFrom(map.first_row, map.first_column, decision_latencies);
+  }
+
+  /**
+   * Play a whole game on a map streamed out of a corpus file.
+   */
+  GameResult Play(const CorpusMapView &map, std::vector<uint32_t> *decision_latencies = nullptr) {
+    server_.InitMapPacked(map.rows, map.columns, map.mines);
+    return PlayFrom(map.first_row, map.first_column, decision_latencies);
+  }
+
+ private:
+  GameResult PlayFrom(int first_row, int first_column, std::vector<uint32_t> *decision_latencies) {
+    player_.InitGame(server_.rows(), server_.columns(), server_.total_mines(), first_row, first_column);
+    GameResult result;
+    while (server_.game_state() == 0) {
+      if (decision_latencies == nullptr) {
+        player_.Decide();
+      } else {
+        const auto start = std::chrono::steady_clock::now();
+        player_.Decide();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        decision_latencies->push_back(
+            static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+      }
+      ++result.decisions;
+    }
+    result.game_state = server_.game_state();
+    result.visit_count = server_.visited_non_mine_count();
+    result.marked_mine_count =
+        result.game_state == 1 ? server_.total_mines() : server_.marked_correct_mines_count();
+    result.guesses = player_.guess_count();
+    return result;
+  }
+
+  // The session's counterpart of Execute() in advanced.cpp
+  void Execute(int r, int c, int type) {
+    if (type == 0) {
+      server_.VisitBlock(r, c);
+    } else if (type == 1) {
+      server_.MarkMine(r, c);
+    } else if (type == 2) {
+      server_.AutoExplore(r, c);
+    }
+    if (server_.game_state() != 0) return;
+    player_.ReadMapView(server_.RenderedMap());
+  }
+
+  GameServer server_;
+  Player player_;
+};
+
+#endif
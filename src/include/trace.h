@@ -0,0 +1,209 @@
+/**
+ * Binary move traces: the map of one game and every operation played on it, recorded by the server (see basic.cpp)
+ * and re-applied by the replay tool without any text I/O.
+ *
+ * Layout (the integers of the header and the map in the byte order of the writing machine, as in corpus.h):
+ *   header   magic "MSWT", uint32 version, uint32 rows, uint32 columns, uint32 byte-order mark, uint32 reserved (0),
+ *            uint64 map hash, uint64 op count
+ *   map      CorpusMineWords(rows, columns) uint64 words: the mine bitset, packed as in corpus.h
+ *   ops      one LEB128 varint per operation, holding ((r * columns + c) * 3 + type) * 4 + (game_state + 1), where
+ *            game_state is the state right after the operation
+ *
+ * The map hash is FNV-1a over rows, columns and the mine words, so a trace can be matched against the map it was
+ * recorded on. Operations outside the board or of an unknown type do nothing on the server and are not recorded.
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include "corpus.h"
+
+constexpr char kTraceMagic[4] = {'M', 'S', 'W', 'T'};
+constexpr uint32_t kTraceVersion = 2;
+
+struct TraceFileHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t rows;
+  uint32_t columns;
+  uint32_t byte_order;  // kCorpusByteOrderMark
+  uint32_t reserved;
+  uint64_t map_hash;
+  uint64_t op_count;
+};
+
+struct TraceOp {
+  int r;
+  int c;
+  int type;        // same as the type argument of Execute()
+  int game_state;  // after the operation
+};
+
+inline uint64_t TraceMapHash(uint32_t rows, uint32_t columns, const uint64_t *mines) {
+  uint64_t hash = 14695981039346656037ull;
+  auto mix = [&hash](uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+      hash ^= (value >> (8 * i)) & 0xff;
+      hash *= 1099511628211ull;
+    }
+  };
+  mix(rows);
+  mix(columns);
+  for (size_t w = 0; w < CorpusMineWords(rows, columns); ++w) mix(mines[w]);
+  return hash;
+}
+
+/**
+ * Records the operations of one game. The op count in the header is filled in by Close() (or the destructor), so a
+ * server that ends with exit() still leaves a complete trace behind as long as the writer has static storage.
+ */
+class TraceWriter {
+ public:
+  ~TraceWriter() { Close(); }
+
+  /**
+   * Start a trace of a game on the given map (packed as in corpus.h).
+   */
+  bool Open(const std::string &path, int rows, int columns, const uint64_t *mines) {
+    out_.open(path, std::ios::binary | std::ios::trunc);
+    header_.rows = static_cast<uint32_t>(rows);
+    header_.columns = static_cast<uint32_t>(columns);
+    header_.map_hash = TraceMapHash(header_.rows, header_.columns, mines);
+    header_.op_count = 0;
+    out_.write(reinterpret_cast<const char *>(&header_), sizeof(header_));
+    out_.write(reinterpret_cast<const char *>(mines),
+               static_cast<std::streamsize>(CorpusMineWords(header_.rows, header_.columns) * 8));
+    return static_cast<bool>(out_);
+  }
+
+  bool is_open() const { return out_.is_open(); }
+
+  void Record(int r, int c, int type, int game_state) {
+    if (!out_.is_open()) return;
+    if (r < 0 || r >= static_cast<int>(header_.rows) || c < 0 || c >= static_cast<int>(header_.columns)) return;
+    if (type < 0 || type > 2) return;
+    uint64_t value = ((static_cast<uint64_t>(r) * header_.columns + c) * 3 + type) * 4 + (game_state + 1);
+    char bytes[10];
+    int length = 0;
+    do {
+      bytes[length++] = static_cast<char>((value & 0x7f) | (value >= 0x80 ? 0x80 : 0));
+      value >>= 7;
+    } while (value != 0);
+    out_.write(bytes, length);
+    ++header_.op_count;
+  }
+
+  bool Close() {
+    if (!out_.is_open()) return true;
+    out_.seekp(0);
+    out_.write(reinterpret_cast<const char *>(&header_), sizeof(header_));
+    out_.close();
+    return !out_.fail();
+  }
+
+ private:
+  std::ofstream out_;
+  TraceFileHeader header_{{'M', 'S', 'W', 'T'}, kTraceVersion, 0, 0, kCorpusByteOrderMark, 0, 0, 0};
+};
+
+/**
+ * Streams the operations of a trace file straight out of a read-only memory mapping.
+ */
+class TraceReader {
+ public:
+  TraceReader() = default;
+  TraceReader(const TraceReader &) = delete;
+  TraceReader &operator=(const TraceReader &) = delete;
+  ~TraceReader() { Close(); }
+
+  /**
+   * Map the file and check its header and map hash. Returns false (and stays closed) if the file is missing, is not a
+   * trace, was written in the other byte order, has a board size a corpus record could not have or its map does not
+   * match the hash.
+   */
+  bool Open(const std::string &path) {
+    Close();
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(TraceFileHeader)) {
+      close(fd);
+      return false;
+    }
+    size_ = static_cast<size_t>(info.st_size);
+    void *data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+    data_ = static_cast<const uint8_t *>(data);
+    madvise(data, size_, MADV_SEQUENTIAL);
+    std::memcpy(&header_, data_, sizeof(header_));
+    const size_t map_bytes = CorpusMineWords(header_.rows, header_.columns) * 8;
+    if (std::memcmp(header_.magic, kTraceMagic, sizeof(header_.magic)) != 0 || header_.version != kTraceVersion ||
+        header_.byte_order != kCorpusByteOrderMark || header_.rows < 1 || header_.rows > kMaxCorpusBoardSide ||
+        header_.columns < 1 || header_.columns > kMaxCorpusBoardSide || sizeof(TraceFileHeader) + map_bytes > size_ ||
+        TraceMapHash(header_.rows, header_.columns, mines()) != header_.map_hash) {
+      Close();
+      return false;
+    }
+    Rewind();
+    return true;
+  }
+
+  void Close() {
+    if (data_ != nullptr) munmap(const_cast<uint8_t *>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+  int rows() const { return static_cast<int>(header_.rows); }
+  int columns() const { return static_cast<int>(header_.columns); }
+  uint64_t map_hash() const { return header_.map_hash; }
+  uint64_t op_count() const { return header_.op_count; }
+  // The recorded map, packed as in corpus.h
+  const uint64_t *mines() const { return reinterpret_cast<const uint64_t *>(data_ + sizeof(TraceFileHeader)); }
+
+  void Rewind() {
+    offset_ = sizeof(TraceFileHeader) + CorpusMineWords(header_.rows, header_.columns) * 8;
+    ops_read_ = 0;
+  }
+
+  /**
+   * Decode the next operation. Returns false at the end of the trace or on a truncated varint.
+   */
+  bool Next(TraceOp &op) {
+    if (data_ == nullptr || ops_read_ == header_.op_count) return false;
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      if (offset_ == size_ || shift > 63) return false;
+      const uint8_t byte = data_[offset_++];
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) break;
+    }
+    op.game_state = static_cast<int>(value % 4) - 1;
+    value /= 4;
+    op.type = static_cast<int>(value % 3);
+    value /= 3;
+    op.r = static_cast<int>(value / header_.columns);
+    op.c = static_cast<int>(value % header_.columns);
+    ++ops_read_;
+    return true;
+  }
+
+ private:
+  const uint8_t *data_ = nullptr;
+  size_t size_ = 0;
+  size_t offset_ = 0;
+  uint64_t ops_read_ = 0;
+  TraceFileHeader header_{};
+};
+
+#endif
@@ -0,0 +1,62 @@
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "generator.h"
+#include "large_server.h"
+
+/**
+ * Large-board server. The protocol follows basic.cpp, except that the map is given as a list of mines and every move
+ * is answered with a viewport instead of the full board.
+ *
+ * Input:
+ *   rows columns view_rows view_columns
+ *   list N                                                    followed by N lines "r c", one per mine, or
+ *   random N seed min_dist first_row first_column             N mines scattered by GenerateSparseMines()
+ *   x y type                                                  moves as in basic.cpp, until the game ends
+ *
+ * After the map and after every move, the view_rows x view_columns window centred on the last move (clamped to the
+ * board) is printed. When the game ends, the same two lines as ExitGame() follow.
+ */
+int main() {
+  std::ios::sync_with_stdio(false);
+  int rows, columns, view_rows, view_columns;
+  std::string source;
+  int mine_count;
+  std::cin >> rows >> columns >> view_rows >> view_columns >> source >> mine_count;
+  std::vector<std::pair<int, int>> mines;
+  if (source == "random") {
+    uint64_t seed;
+    int min_dist, first_row, first_column;
+    std::cin >> seed >> min_dist >> first_row >> first_column;
+    InitSeed(seed);
+    mines = GenerateSparseMines(rows, columns, mine_count, first_row, first_column, min_dist);
+  } else {
+    mines.resize(mine_count);
+    for (auto &[r, c] : mines) std::cin >> r >> c;
+  }
+  LargeGameServer server;
+  server.InitMap(rows, columns, mines);
+  server.PrintRegion(std::cout, 0, 0, view_rows, view_columns);
+  int pos_x, pos_y, type;
+  while (std::cin >> pos_x >> pos_y >> type) {
+    if (type == 0) {
+      server.VisitBlock(pos_x, pos_y);
+    } else if (type == 1) {
+      server.MarkMine(pos_x, pos_y);
+    } else if (type == 2) {
+      server.AutoExplore(pos_x, pos_y);
+    }
+    const int top = std::max(0, std::min(pos_x - view_rows / 2, rows - view_rows));
+    const int left = std::max(0, std::min(pos_y - view_columns / 2, columns - view_columns));
+    server.PrintRegion(std::cout, top, left, view_rows, view_columns);
+    if (server.game_state() != 0) {
+      std::cout << (server.game_state() == 1 ? "YOU WIN!" : "GAME OVER!") << std::endl;
+      std::cout << server.visited_non_mine_count() << " "
+                << (server.game_state() == 1 ? server.total_mines() : server.marked_correct_mines_count()) << std::endl;
+      return 0;
+    }
+  }
+}
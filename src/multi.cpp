@@ -0,0 +1,191 @@
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "multi_server.h"
+
+/**
+ * Session-multiplexed server: many games at once in one process, for load generators and batch drivers that would
+ * otherwise start a server process per game.
+ *
+ *   multi_server [threads]
+ *
+ * Every request is one line starting with a session id (an unsigned 64-bit integer):
+ *   id map R C row_0 ... row_{R-1}          start a game on the given map ('.' and 'X', as read by InitMap())
+ *   id random R C mines seed min_dist       start a game on GenerateMapData(R, C, mines, min_dist) drawn with the
+ *                                           seed, and make its safe first move
+ *   id x y type                             one move, as in basic.cpp
+ *   id B N x1 y1 type1 ... xN yN typeN      N moves, as the batch command of basic.cpp
+ *   id end                                  drop the game
+ * Starting a game under a live id replaces that game. A game that ends is dropped after its last response.
+ *
+ * Responses are "id game_state visits marked" followed by the board as PrintMap() prints it, "id closed" for end and
+ * "id error message" for a request that could not be carried out. The responses of one session come in request order;
+ * those of different sessions may interleave in any order.
+ *
+ * A reader thread cuts the input into lines and deals them to the worker threads by session id (SessionShardOf()), in
+ * one batch per worker per read. Each worker owns its sessions outright and sends back a batch of responses, which a
+ * writer thread puts out. Batches travel on single-producer single-consumer queues, so no lock is shared on the way.
+ * A summary goes to stderr at the end of the input.
+ */
+
+namespace {
+
+constexpr size_t kReadChunk = 1 << 16;
+constexpr size_t kQueueBatches = 1024;
+
+struct Worker {
+  Worker() : requests(kQueueBatches), responses(kQueueBatches) {}
+  SpscQueue<std::string> requests;
+  SpscQueue<std::string> responses;
+  SessionShard shard;
+  std::thread thread;
+};
+
+void WriteAll(const std::string &data) {
+  size_t written = 0;
+  while (written < data.size()) {
+    const ssize_t n = write(STDOUT_FILENO, data.data() + written, data.size() - written);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) std::exit(1);  // nobody is reading any more
+    written += static_cast<size_t>(n);
+  }
+}
+
+void Push(SpscQueue<std::string> &queue, std::string &batch) {
+  Backoff backoff;
+  while (!queue.TryPush(batch)) backoff.Wait();
+}
+
+/**
+ * The id a line is dealt by. A line without one is dealt as id 0, and its worker answers it with an error.
+ */
+uint64_t LineSessionId(std::string_view line) {
+  const size_t begin = std::min(line.find_first_not_of(" \t"), line.size());
+  uint64_t id = 0;
+  std::from_chars(line.data() + begin, line.data() + line.size(), id);
+  return id;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const int threads =
+      argc > 1 ? std::atoi(argv[1]) : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  if (threads < 1) {
+    std::cerr << "usage: multi_server [threads]\n";
+    return 2;
+  }
+  std::vector<std::unique_ptr<Worker>> workers;
+  for (int i = 0; i < threads; ++i) workers.push_back(std::make_unique<Worker>());
+  std::atomic<bool> input_done{false};
+  std::atomic<int> workers_done{0};
+  const auto start = std::chrono::steady_clock::now();
+
+  for (auto &worker : workers) {
+    worker->thread = std::thread([&input_done, &workers_done, &worker = *worker] {
+      Backoff backoff;
+      std::string batch;
+      while (true) {
+        const bool done = input_done.load(std::memory_order_acquire);
+        if (!worker.requests.TryPop(batch)) {
+          if (done) break;
+          backoff.Wait();
+          continue;
+        }
+        backoff.Reset();
+        std::string responses;
+        size_t begin = 0;
+        while (begin < batch.size()) {
+          const size_t end = batch.find('\n', begin);
+          worker.shard.Handle(std::string_view(batch).substr(begin, end - begin), responses);
+          begin = end + 1;
+        }
+        Push(worker.responses, responses);
+      }
+      workers_done.fetch_add(1, std::memory_order_release);
+    });
+  }
+  std::thread writer([&] {
+    Backoff backoff;
+    std::string batch;
+    while (true) {
+      const bool done = workers_done.load(std::memory_order_acquire) == threads;
+      bool wrote = false;
+      for (auto &worker : workers) {
+        while (worker->responses.TryPop(batch)) {
+          WriteAll(batch);
+          wrote = true;
+        }
+      }
+      if (wrote) {
+        backoff.Reset();
+      } else if (done) {
+        break;
+      } else {
+        backoff.Wait();
+      }
+    }
+  });
+
+  // Read whatever input is available, and deal out every complete line
+  std::vector<std::string> pending(threads);
+  std::string buffer(kReadChunk, '\0');
+  size_t filled = 0;
+  auto deal = [&](std::string_view line) {
+    if (line.find_first_not_of(" \t\r") == std::string_view::npos) return;
+    std::string &batch = pending[SessionShardOf(LineSessionId(line), threads)];
+    batch.append(line);
+    batch += '\n';
+  };
+  while (true) {
+    if (filled == buffer.size()) buffer.resize(buffer.size() * 2);  // a line longer than the buffer
+    const ssize_t n = read(STDIN_FILENO, &buffer[filled], buffer.size() - filled);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    filled += static_cast<size_t>(n);
+    size_t begin = 0;
+    for (size_t end; (end = buffer.find('\n', begin)) < filled; begin = end + 1) {
+      deal(std::string_view(buffer).substr(begin, end - begin));
+    }
+    std::memmove(&buffer[0], &buffer[begin], filled - begin);
+    filled -= begin;
+    for (int i = 0; i < threads; ++i) {
+      if (!pending[i].empty()) Push(workers[i]->requests, pending[i]);
+      pending[i].clear();
+    }
+  }
+  deal(std::string_view(buffer).substr(0, filled));
+  for (int i = 0; i < threads; ++i) {
+    if (!pending[i].empty()) Push(workers[i]->requests, pending[i]);
+  }
+  input_done.store(true, std::memory_order_release);
+  for (auto &worker : workers) worker->thread.join();
+  writer.join();
+
+  uint64_t started = 0, finished = 0, operations = 0, live = 0, boards = 0;
+  for (const auto &worker : workers) {
+    started += worker->shard.sessions_started();
+    finished += worker->shard.games_finished();
+    operations += worker->shard.operations();
+    live += worker->shard.live_sessions();
+    boards += worker->shard.boards();
+  }
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::cerr << started << " sessions, " << finished << " games finished, " << live << " still open, " << operations
+            << " operations in " << seconds << " s (" << (seconds > 0 ? operations / seconds : 0.0) << " ops/s), "
+            << boards << " boards allocated" << std::endl;
+  return 0;
+}
@@ -0,0 +1,243 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "game_client.h"
+#include "generator.h"
+#include "pattern.h"
+#include "session.h"
+
+/**
+ * Offline generator of pattern_table.h (see pattern.h).
+ *
+ *   pattern_gen [games_per_config] [min_count] > src/include/pattern_table.h
+ *
+ * Enumerating every 5x5 window is out of reach (there are about 11^8 * 2^16 of them before symmetry), so the
+ * generator enumerates the windows that actually come up: it plays seeded games of the usual grading sizes with the
+ * full client and, on every map the client reads, takes the window around each unknown cell next to a number. Every new
+ * canonical window is solved exactly by enumerating its unknowns. Windows whose centre is forced, and that the
+ * single-cell rules of Decide() would not settle anyway, are kept if they were met at least min_count times, and laid
+ * out in a hash-and-displace perfect hash table.
+ */
+
+namespace {
+
+struct PatternStats {
+  int count = 0;
+  int verdict = -1;  // -1 not forced, 0 safe, 1 mine
+};
+
+std::unordered_map<uint64_t, PatternStats> patterns;
+
+/**
+ * Whether a normalized window has a number that the single-cell rules settle by themselves.
+ */
+bool Uninteresting(const uint8_t *window) {
+  for (int j = 0; j < kPatternCells; ++j) {
+    if (!pattern_detail::Inner(j) || window[j] < kPatternNumber) continue;
+    int unknown = 0;
+    for (int i = 0; i < kPatternCells; ++i) unknown += window[i] == kPatternUnknown && pattern_detail::Adjacent(i, j);
+    const int needed = window[j] - kPatternNumber;
+    if (needed == 0 || needed >= unknown) return true;
+  }
+  return false;
+}
+
+/**
+ * Enumerate the unknowns of a window and return which values of the centre some consistent assignment allows (bit 0
+ * for safe, bit 1 for a mine).
+ */
+int FeasibleCentre(const uint8_t *window) {
+  std::vector<int> variables = {kPatternCentre};
+  for (int i = 0; i < kPatternCells; ++i) {
+    if (i != kPatternCentre && window[i] == kPatternUnknown) variables.push_back(i);
+  }
+  std::vector<int> constraint_cells, needed, open;
+  for (int j = 0; j < kPatternCells; ++j) {
+    if (!pattern_detail::Inner(j) || window[j] < kPatternNumber) continue;
+    constraint_cells.push_back(j);
+    needed.push_back(window[j] - kPatternNumber);
+    int unknown = 0;
+    for (int v : variables) unknown += pattern_detail::Adjacent(v, j);
+    open.push_back(unknown);
+  }
+  int feasible = 0;
+  auto search = [&](auto &&self, size_t k, int centre) -> void {
+    if (feasible == 3) return;
+    if (k == variables.size()) {
+      feasible |= 1 << centre;
+      return;
+    }
+    for (int mine = 0; mine <= 1; ++mine) {
+      bool ok = true;
+      for (size_t j = 0; j < constraint_cells.size(); ++j) {
+        if (!pattern_detail::Adjacent(variables[k], constraint_cells[j])) continue;
+        --open[j];
+        needed[j] -= mine;
+        if (needed[j] < 0 || needed[j] > open[j]) ok = false;
+      }
+      if (ok) self(self, k + 1, k == 0 ? mine : centre);
+      for (size_t j = 0; j < constraint_cells.size(); ++j) {
+        if (!pattern_detail::Adjacent(variables[k], constraint_cells[j])) continue;
+        ++open[j];
+        needed[j] += mine;
+      }
+    }
+  };
+  search(search, 0, 0);
+  return feasible;
+}
+
+/**
+ * Wraps the full client and records the windows of every map it reads.
+ */
+class HarvestingClient {
+ public:
+  // The table being generated must not steer the games it is generated from
+  explicit HarvestingClient(GameClient::Executor execute) : client_(std::move(execute), WithoutPatterns()) {}
+
+  void InitGame(int rows, int columns, int total_mines, int first_row, int first_column) {
+    rows_ = rows;
+    columns_ = columns;
+    client_.InitGame(rows, columns, total_mines, first_row, first_column);
+  }
+
+  void ReadMapView(const char *frame) {
+    Harvest(frame);
+    client_.ReadMapView(frame);
+  }
+
+  void Decide() { client_.Decide(); }
+  int guess_count() const { return client_.guess_count(); }
+
+ private:
+  char At(const char *frame, int r, int c) const {
+    if (r < 0 || r >= rows_ || c < 0 || c >= columns_) return kBorderCell;
+    return frame[static_cast<size_t>(r) * (columns_ + 1) + c];
+  }
+
+  void Harvest(const char *frame) {
+    uint8_t window[kPatternCells];
+    for (int r = 0; r < rows_; ++r) {
+      for (int c = 0; c < columns_; ++c) {
+        if (At(frame, r, c) != '?') continue;
+        for (int i = 0; i < kPatternCells; ++i) {
+          const int wr = r + pattern_detail::Row(i) - 2, wc = c + pattern_detail::Column(i) - 2;
+          const char ch = At(frame, wr, wc);
+          window[i] = ch == '?' ? kPatternUnknown : kPatternInert;
+          if (!pattern_detail::Inner(i) || !is_number(ch)) continue;
+          int marked = 0;
+          for (int k = 0; k < 8; ++k) {
+            marked += At(frame, wr + kNeighborRowOffsets[k], wc + kNeighborColumnOffsets[k]) == '@';
+          }
+          window[i] = static_cast<uint8_t>(kPatternNumber + (ch - '0') - marked);
+        }
+        if (!NormalizePattern(window) || Uninteresting(window)) continue;
+        PatternStats &stats = patterns[PatternKey(window)];
+        if (stats.count++ == 0) {
+          const int feasible = FeasibleCentre(window);
+          stats.verdict = feasible == 1 ? 0 : feasible == 2 ? 1 : -1;
+        }
+      }
+    }
+  }
+
+  static ClientOptions WithoutPatterns() {
+    ClientOptions options;
+    options.pattern_table = false;
+    return options;
+  }
+
+  GameClient client_;
+  int rows_ = 0;
+  int columns_ = 0;
+};
+
+/**
+ * Place the keys with hash-and-displace: the keys of each bucket share one seed, found by trying seeds until all of
+ * them land in free slots. Larger buckets go first. Returns false if some bucket found no seed.
+ */
+bool BuildTable(const std::vector<uint64_t> &entries, uint64_t buckets, uint64_t slots, std::vector<uint16_t> &seeds,
+                std::vector<uint64_t> &table) {
+  std::vector<std::vector<uint64_t>> members(buckets);
+  for (uint64_t entry : entries) members[PatternHash(entry & kPatternKeyMask, 0) % buckets].push_back(entry);
+  std::vector<uint64_t> order(buckets);
+  for (uint64_t b = 0; b < buckets; ++b) order[b] = b;
+  std::stable_sort(order.begin(), order.end(),
+                   [&](uint64_t a, uint64_t b) { return members[a].size() > members[b].size(); });
+  seeds.assign(buckets, 0);
+  table.assign(slots, 0);
+  std::vector<uint64_t> placed;
+  for (uint64_t b : order) {
+    if (members[b].empty()) break;
+    bool done = false;
+    for (uint32_t seed = 1; seed <= 0xffff && !done; ++seed) {
+      placed.clear();
+      done = true;
+      for (uint64_t entry : members[b]) {
+        const uint64_t slot = PatternHash(entry & kPatternKeyMask, seed) % slots;
+        if (table[slot] != 0 || std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+          done = false;
+          break;
+        }
+        placed.push_back(slot);
+      }
+      if (!done) continue;
+      for (size_t k = 0; k < placed.size(); ++k) table[placed[k]] = members[b][k];
+      seeds[b] = static_cast<uint16_t>(seed);
+    }
+    if (!done) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const int games = argc > 1 ? std::atoi(argv[1]) : 500;
+  const int min_count = argc > 2 ? std::atoi(argv[2]) : 2;
+  struct Config {
+    int rows, columns, mines, min_dist;
+  };
+  const std::vector<Config> configs = {{9, 9, 10, 1},    {16, 16, 40, 1},  {16, 30, 99, 1},
+                                       {30, 30, 150, 2}, {30, 30, 200, 1}, {30, 30, 180, 1}};
+  InitSeed(20251021);
+  for (const Config &config : configs) {
+    for (int i = 0; i < games; ++i) {
+      GameSession<HarvestingClient> session;
+      session.Play(GenerateMapData(config.rows, config.columns, config.mines, config.min_dist));
+    }
+  }
+
+  std::vector<uint64_t> entries;
+  for (const auto &[key, stats] : patterns) {
+    if (stats.verdict == -1 || stats.count < min_count) continue;
+    entries.push_back(key | kPatternUsed | (stats.verdict == 1 ? kPatternMine : 0));
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](uint64_t a, uint64_t b) { return (a & kPatternKeyMask) < (b & kPatternKeyMask); });
+  const uint64_t buckets = std::max<uint64_t>(1, entries.size() / 4);
+  uint64_t slots = std::max<uint64_t>(1, entries.size() + entries.size() / 4);
+  std::vector<uint16_t> seeds;
+  std::vector<uint64_t> table;
+  while (!BuildTable(entries, buckets, slots, seeds, table)) slots += slots / 8 + 1;
+  std::cerr << patterns.size() << " windows met, " << entries.size() << " forced, " << slots << " slots" << std::endl;
+
+  std::cout << "// Generated by pattern_gen " << games << " " << min_count << "; do not edit. See pattern.h.\n"
+            << "#ifndef PATTERN_TABLE_H\n#define PATTERN_TABLE_H\n\n#include <cstdint>\n\n"
+            << "constexpr uint64_t kPatternBuckets = " << buckets << ";\n"
+            << "constexpr uint64_t kPatternSlots = " << slots << ";\n"
+            << "constexpr uint16_t kPatternSeeds[] = {";
+  for (uint64_t b = 0; b < buckets; ++b) std::cout << (b % 16 == 0 ? "\n    " : " ") << seeds[b] << ",";
+  std::cout << "\n};\nconstexpr uint64_t kPatternEntries[] = {";
+  for (uint64_t s = 0; s < slots; ++s) {
+    std::cout << (s % 4 == 0 ? "\n    " : " ") << "0x" << std::hex << table[s] << std::dec << "ull,";
+  }
+  std::cout << "\n};\n\n#endif\n";
+  return 0;
+}
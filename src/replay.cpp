@@ -0,0 +1,77 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#include "server.h"
+#include "trace.h"
+
+/**
+ * Deterministic replay of a binary move trace (see trace.h and server --trace).
+ *
+ *   replay <file> [repeat]
+ *       Load the recorded map into a server, re-apply every operation without printing anything and check that each
+ *       one leaves the game in the recorded state. With repeat > 1 the whole game is replayed that many times, which
+ *       turns recorded sessions into performance regression inputs. Prints the outcome and the replay speed.
+ */
+
+namespace {
+
+int Usage() {
+  std::cerr << "usage: replay <file> [repeat]\n";
+  return 2;
+}
+
+const char *Outcome(int game_state) {
+  if (game_state == 1) return "win";
+  if (game_state == -1) return "loss";
+  return "unfinished";
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc != 2 && argc != 3) return Usage();
+  const int repeat = argc == 3 ? std::atoi(argv[2]) : 1;
+  if (repeat < 1) return Usage();
+  TraceReader reader;
+  if (!reader.Open(argv[1])) {
+    std::cerr << argv[1] << " is not a readable trace\n";
+    return 1;
+  }
+  GameServer server;
+  TraceOp op;
+  uint64_t ops = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < repeat; ++round) {
+    server.InitMapPacked(reader.rows(), reader.columns(), reader.mines());
+    reader.Rewind();
+    uint64_t i = 0;
+    for (; reader.Next(op); ++i) {
+      if (op.type == 0) {
+        server.VisitBlock(op.r, op.c);
+      } else if (op.type == 1) {
+        server.MarkMine(op.r, op.c);
+      } else {
+        server.AutoExplore(op.r, op.c);
+      }
+      if (server.game_state() != op.game_state) {
+        std::cerr << "op " << i << " (" << op.r << " " << op.c << " " << op.type << ") left the game "
+                  << Outcome(server.game_state()) << ", the trace says " << Outcome(op.game_state) << std::endl;
+        return 1;
+      }
+    }
+    if (i != reader.op_count()) {
+      std::cerr << "trace truncated after " << i << " of " << reader.op_count() << " ops" << std::endl;
+      return 1;
+    }
+    ops += i;
+  }
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::cout << "map " << std::hex << reader.map_hash() << std::dec << " " << reader.rows() << "x" << reader.columns()
+            << " ops " << reader.op_count() << " outcome " << Outcome(server.game_state()) << " visits "
+            << server.visited_non_mine_count() << " marked " << server.marked_correct_mines_count() << "\n";
+  std::cout << "replayed " << ops << " ops in " << seconds << " s, " << (seconds > 0 ? ops / seconds : 0.0)
+            << " ops/s" << std::endl;
+  return 0;
+}
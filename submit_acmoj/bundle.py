@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Header bundler for ACMOJ submissions.
+
+ACMOJ compiles a single submitted header (server.h for 2876, client.h for 2877) next to the stock drivers, so the
+local headers it includes are not there. This tool writes a copy of the header with every local `#include "..."`
+replaced, recursively, by the included file. Each file is inlined once, at its first include, and keeps its include
+guard. System includes (`#include <...>`) are left as they are.
+
+Usage Examples:
+1. Bundle server.h for problem 2876:
+   python3 submit_acmoj/bundle.py src/include/server.h -o server.h --check
+
+2. Bundle client.h for problem 2877:
+   python3 submit_acmoj/bundle.py src/include/client.h -o client.h --check
+
+--check compiles the bundle on its own in an empty directory (g++ -fsyntax-only), so a header that still needs a
+file of this repository fails here rather than on the judge.
+"""
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+LOCAL_INCLUDE = re.compile(r'^\s*#\s*include\s+"([^"]+)"')
+
+
+def bundle(path: str, inlined: set, out: list) -> None:
+    """Append the lines of `path` to `out`, with the local headers it includes inlined unless already in `inlined`."""
+    path = os.path.realpath(path)
+    inlined.add(path)
+    with open(path, encoding='utf-8') as source:
+        for line in source:
+            match = LOCAL_INCLUDE.match(line)
+            if not match:
+                out.append(line)
+                continue
+            included = os.path.realpath(os.path.join(os.path.dirname(path), match.group(1)))
+            if not os.path.isfile(included):
+                raise FileNotFoundError(f'{path}: cannot find included file "{match.group(1)}"')
+            if included in inlined:
+                continue
+            out.append(f'// ---- begin {match.group(1)} ----\n')
+            bundle(included, inlined, out)
+            out.append(f'// ---- end {match.group(1)} ----\n')
+
+
+def check(bundled: str, name: str, compiler: str) -> bool:
+    """Compile the bundle alone in an empty directory. Returns whether it compiled."""
+    directory = tempfile.mkdtemp(prefix='acmoj_bundle_')
+    try:
+        header = os.path.join(directory, name)
+        with open(header, 'w', encoding='utf-8') as target:
+            target.write(bundled)
+        result = subprocess.run([compiler, '-std=c++17', '-fsyntax-only', '-x', 'c++', header],
+                                cwd=directory, capture_output=True, text=True)
+        if result.returncode != 0:
+            sys.stderr.write(result.stderr)
+        return result.returncode == 0
+    finally:
+        shutil.rmtree(directory)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description='Inline the local headers of a header for single-file submission')
+    parser.add_argument('header', help='header to bundle, e.g. src/include/server.h')
+    parser.add_argument('-o', '--output', help='file to write (default: standard output)')
+    parser.add_argument('--check', action='store_true', help='compile the bundle alone before writing it')
+    parser.add_argument('--compiler', default='g++', help='compiler used by --check (default: g++)')
+    args = parser.parse_args()
+
+    lines = [f'// Bundled by submit_acmoj/bundle.py from {os.path.basename(args.header)}; edit the sources instead.\n']
+    try:
+        bundle(args.header, set(), lines)
+    except (OSError, FileNotFoundError) as error:
+        sys.stderr.write(f'{error}\n')
+        return 1
+    bundled = ''.join(lines)
+
+    if args.check and not check(bundled, os.path.basename(args.header), args.compiler):
+        sys.stderr.write(f'{args.header}: the bundle does not compile on its own\n')
+        return 1
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8') as target:
+            target.write(bundled)
+    else:
+        sys.stdout.write(bundled)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
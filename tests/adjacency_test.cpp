@@ -0,0 +1,73 @@
+/**
+ * Differential test of the adjacency row kernels: every kernel this CPU can run must produce the same counts and zero
+ * bits as the scalar one on random padded rows, for widths on either side of the 16- and 32-byte vector steps and of
+ * the 64-bit zero-bit words. Bytes past the row in `counts` and zero-bit words past the row must stay untouched.
+ *
+ * Usage: adjacency_test [rows] [seed]
+ */
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "adjacency.h"
+
+namespace {
+
+struct NamedKernel {
+  const char *name;
+  AdjacencyRowFunction kernel;
+};
+
+std::vector<NamedKernel> Kernels() {
+  std::vector<NamedKernel> kernels = {{"selected", AdjacencyRowKernel()}};
+#ifdef ADJACENCY_X86
+  kernels.push_back({"sse2", adjacency_detail::CountRowSse2});
+  if (__builtin_cpu_supports("avx2")) kernels.push_back({"avx2", adjacency_detail::CountRowAvx2});
+#endif
+  return kernels;
+}
+
+constexpr uint8_t kCountSentinel = 0xa5;
+constexpr uint64_t kWordSentinel = 0x5a5a5a5a5a5a5a5aull;
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const int rows = argc > 1 ? std::atoi(argv[1]) : 20000;
+  const uint64_t seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1;
+  std::mt19937_64 rng(seed);
+  const std::vector<NamedKernel> kernels = Kernels();
+  std::vector<uint8_t> plane, expected_counts, counts;
+  std::vector<uint64_t> expected_bits, bits;
+  for (int test = 0; test < rows; ++test) {
+    const int width = test < 200 ? test + 1 : std::uniform_int_distribution<int>(1, 300)(rng);
+    const double density = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+    std::bernoulli_distribution is_mine(density);
+    // Three padded rows of width + 2 bytes: above, the row itself and below
+    const int stride = width + 2;
+    plane.assign(static_cast<size_t>(3) * stride, 0);
+    for (int r = 0; r < 3; ++r) {
+      for (int j = 1; j <= width; ++j) plane[static_cast<size_t>(r) * stride + j] = is_mine(rng);
+    }
+    const int words = (width + 63) / 64;
+    expected_counts.assign(width + 1, kCountSentinel);
+    expected_bits.assign(words + 1, kWordSentinel);
+    adjacency_detail::CountRowScalar(plane.data(), plane.data() + stride, plane.data() + 2 * stride, width,
+                                     expected_counts.data(), expected_bits.data());
+    for (const NamedKernel &kernel : kernels) {
+      counts.assign(width + 1, kCountSentinel);
+      bits.assign(words + 1, kWordSentinel);
+      kernel.kernel(plane.data(), plane.data() + stride, plane.data() + 2 * stride, width, counts.data(), bits.data());
+      if (counts != expected_counts || bits != expected_bits) {
+        std::cerr << "kernel " << kernel.name << " differs from the scalar kernel at width " << width << " (row "
+                  << test << ")\n";
+        return 1;
+      }
+    }
+  }
+  std::cout << rows << " rows agree across " << kernels.size() << " kernels\n";
+  return 0;
+}
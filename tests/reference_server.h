@@ -0,0 +1,139 @@
+/**
+ * The rules of the stock server, kept as plain as possible: a grid of bools per state, adjacency by looping over the
+ * eight neighbours and a queue-based flood fill. It is the same logic as the server.h this repository started from,
+ * moved into a class, and it is what the differential tests hold the optimized servers to.
+ */
+#ifndef REFERENCE_SERVER_H
+#define REFERENCE_SERVER_H
+
+#include <cstdint>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+class ReferenceServer {
+ public:
+  // `mines` holds rows * columns bytes in row-major order, nonzero for a mine
+  void InitMap(int rows, int columns, const std::vector<uint8_t> &mines) {
+    rows_ = rows;
+    columns_ = columns;
+    mine_.assign(rows, std::vector<bool>(columns, false));
+    adjacent_.assign(rows, std::vector<int>(columns, 0));
+    visited_.assign(rows, std::vector<bool>(columns, false));
+    marked_.assign(rows, std::vector<bool>(columns, false));
+    total_mines_ = visited_non_mine_count_ = marked_correct_mines_count_ = game_state_ = 0;
+    for (int i = 0; i < rows; ++i) {
+      for (int j = 0; j < columns; ++j) {
+        mine_[i][j] = mines[static_cast<size_t>(i) * columns + j] != 0;
+        total_mines_ += mine_[i][j];
+      }
+    }
+    for (int i = 0; i < rows; ++i) {
+      for (int j = 0; j < columns; ++j) {
+        for (int k = 0; k < 8; ++k) {
+          const int ni = i + kRowOffsets[k], nj = j + kColumnOffsets[k];
+          if (InBounds(ni, nj) && mine_[ni][nj]) ++adjacent_[i][j];
+        }
+      }
+    }
+  }
+
+  void VisitBlock(int r, int c) {
+    if (game_state_ != 0 || !InBounds(r, c) || visited_[r][c] || marked_[r][c]) return;
+    if (mine_[r][c]) {
+      visited_[r][c] = true;
+      game_state_ = -1;
+      return;
+    }
+    FloodVisitFrom(r, c);
+  }
+
+  void MarkMine(int r, int c) {
+    if (game_state_ != 0 || !InBounds(r, c) || visited_[r][c] || marked_[r][c]) return;
+    marked_[r][c] = true;
+    if (mine_[r][c]) {
+      ++marked_correct_mines_count_;
+    } else {
+      game_state_ = -1;
+    }
+  }
+
+  void AutoExplore(int r, int c) {
+    if (game_state_ != 0 || !InBounds(r, c) || !visited_[r][c] || mine_[r][c]) return;
+    int marked_neighbors = 0;
+    for (int k = 0; k < 8; ++k) {
+      const int nr = r + kRowOffsets[k], nc = c + kColumnOffsets[k];
+      if (InBounds(nr, nc) && marked_[nr][nc]) ++marked_neighbors;
+    }
+    if (marked_neighbors != adjacent_[r][c]) return;
+    for (int k = 0; k < 8; ++k) {
+      const int nr = r + kRowOffsets[k], nc = c + kColumnOffsets[k];
+      if (!InBounds(nr, nc) || mine_[nr][nc] || visited_[nr][nc] || marked_[nr][nc]) continue;
+      FloodVisitFrom(nr, nc);
+      if (game_state_ != 0) return;
+    }
+  }
+
+  // The frame PrintMap() prints: rows lines of columns characters, each followed by '\n'
+  std::string Render() const {
+    std::string frame;
+    for (int i = 0; i < rows_; ++i) {
+      for (int j = 0; j < columns_; ++j) {
+        const char digit = static_cast<char>('0' + adjacent_[i][j]);
+        if (game_state_ == 1) {
+          frame.push_back(mine_[i][j] ? '@' : digit);
+        } else if (visited_[i][j]) {
+          frame.push_back(mine_[i][j] ? 'X' : digit);
+        } else if (marked_[i][j]) {
+          frame.push_back(mine_[i][j] ? '@' : 'X');
+        } else {
+          frame.push_back('?');
+        }
+      }
+      frame.push_back('\n');
+    }
+    return frame;
+  }
+
+  bool visited(int r, int c) const { return visited_[r][c]; }
+  bool mine(int r, int c) const { return mine_[r][c]; }
+  int total_mines() const { return total_mines_; }
+  int game_state() const { return game_state_; }
+  int visited_non_mine_count() const { return visited_non_mine_count_; }
+  int marked_correct_mines_count() const { return marked_correct_mines_count_; }
+
+ private:
+  static constexpr int kRowOffsets[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+  static constexpr int kColumnOffsets[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+
+  bool InBounds(int r, int c) const { return r >= 0 && r < rows_ && c >= 0 && c < columns_; }
+
+  void FloodVisitFrom(int r0, int c0) {
+    std::queue<std::pair<int, int>> queue;
+    auto try_visit = [&](int r, int c) {
+      if (!InBounds(r, c) || mine_[r][c] || visited_[r][c] || marked_[r][c]) return;
+      visited_[r][c] = true;
+      ++visited_non_mine_count_;
+      if (adjacent_[r][c] == 0) queue.emplace(r, c);
+    };
+    try_visit(r0, c0);
+    while (!queue.empty()) {
+      const auto [r, c] = queue.front();
+      queue.pop();
+      for (int k = 0; k < 8; ++k) try_visit(r + kRowOffsets[k], c + kColumnOffsets[k]);
+    }
+    if (visited_non_mine_count_ == rows_ * columns_ - total_mines_) game_state_ = 1;
+  }
+
+  int rows_ = 0;
+  int columns_ = 0;
+  int total_mines_ = 0;
+  int game_state_ = 0;
+  int visited_non_mine_count_ = 0;
+  int marked_correct_mines_count_ = 0;
+  std::vector<std::vector<bool>> mine_, visited_, marked_;
+  std::vector<std::vector<int>> adjacent_;
+};
+
+#endif
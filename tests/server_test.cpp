@@ -0,0 +1,139 @@
+/**
+ * Differential test of the servers: GameServer (bitboards, bitwise flood fill, compile-time board sizes) and
+ * LargeGameServer (tiles) play random operation sequences on random maps next to ReferenceServer, and after every
+ * operation they must show the same frame, game state and counts.
+ *
+ * The maps cover the sizes WithBoard() specializes, boards of one row or column, and widths and heights on either side
+ * of the 64-bit word and the 64 x 64 tile. The operations mix visits, right and wrong marks, auto-explores and moves
+ * off the board, so games run long enough to flood, auto-explore and win.
+ *
+ * Usage: server_test [games] [seed]
+ */
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "large_server.h"
+#include "reference_server.h"
+#include "server.h"
+
+namespace {
+
+struct MapSpec {
+  int rows;
+  int columns;
+  double density;
+};
+
+MapSpec DrawSpec(int game, std::mt19937_64 &rng) {
+  static const std::pair<int, int> kFixedSizes[] = {{9, 9}, {16, 16}, {16, 30}, {30, 30}, {1, 1},  {1, 70},
+                                                    {70, 1}, {8, 63}, {8, 64}, {8, 65}, {65, 8}, {66, 130}};
+  const double density = std::uniform_real_distribution<double>(0.0, 0.25)(rng);
+  const int fixed = static_cast<int>(sizeof(kFixedSizes) / sizeof(kFixedSizes[0]));
+  if (game < 2 * fixed) return {kFixedSizes[game % fixed].first, kFixedSizes[game % fixed].second, density};
+  return {std::uniform_int_distribution<int>(1, 40)(rng), std::uniform_int_distribution<int>(1, 140)(rng), density};
+}
+
+// The frame of a GameServer, without the terminating '\0'
+std::string Frame(const GameServer &server) {
+  return std::string(server.RenderedMap(), static_cast<size_t>(server.rows()) * (server.columns() + 1));
+}
+
+std::string Frame(const LargeGameServer &server) {
+  std::ostringstream out;
+  server.PrintRegion(out, 0, 0, server.rows(), server.columns());
+  return out.str();
+}
+
+template <typename Server>
+bool Agrees(const Server &server, const ReferenceServer &reference, const char *name, int game, int step) {
+  if (Frame(server) == reference.Render() && server.game_state() == reference.game_state() &&
+      server.visited_non_mine_count() == reference.visited_non_mine_count() &&
+      server.marked_correct_mines_count() == reference.marked_correct_mines_count() &&
+      server.total_mines() == reference.total_mines()) {
+    return true;
+  }
+  std::cerr << name << " differs from the reference in game " << game << " after operation " << step << "\n"
+            << "state " << server.game_state() << " vs " << reference.game_state() << ", visited "
+            << server.visited_non_mine_count() << " vs " << reference.visited_non_mine_count() << ", marked "
+            << server.marked_correct_mines_count() << " vs " << reference.marked_correct_mines_count() << "\n"
+            << Frame(server) << "reference:\n"
+            << reference.Render();
+  return false;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const int games = argc > 1 ? std::atoi(argv[1]) : 150;
+  const uint64_t seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1;
+  std::mt19937_64 rng(seed);
+  GameServer server;
+  LargeGameServer large;
+  ReferenceServer reference;
+  std::vector<uint8_t> mines;
+  std::vector<std::pair<int, int>> mine_cells;
+  for (int game = 0; game < games; ++game) {
+    const MapSpec spec = DrawSpec(game, rng);
+    mines.assign(static_cast<size_t>(spec.rows) * spec.columns, 0);
+    mine_cells.clear();
+    std::bernoulli_distribution is_mine(spec.density);
+    for (int r = 0; r < spec.rows; ++r) {
+      for (int c = 0; c < spec.columns; ++c) {
+        if (!is_mine(rng)) continue;
+        mines[static_cast<size_t>(r) * spec.columns + c] = 1;
+        mine_cells.emplace_back(r, c);
+      }
+    }
+    server.InitMap(spec.rows, spec.columns, mines.data());
+    large.InitMap(spec.rows, spec.columns, mine_cells);
+    reference.InitMap(spec.rows, spec.columns, mines);
+    if (!Agrees(server, reference, "GameServer", game, 0) || !Agrees(large, reference, "LargeGameServer", game, 0)) {
+      return 1;
+    }
+    std::uniform_int_distribution<int> row(-1, spec.rows), column(-1, spec.columns);
+    for (int step = 1; step <= 200 && reference.game_state() == 0; ++step) {
+      // Mostly moves that keep the game going, so that it gets far enough to flood, auto-explore and win
+      int r = row(rng), c = column(rng);
+      for (int retry = 0; retry < 8 && (r < 0 || r >= spec.rows || c < 0 || c >= spec.columns); ++retry) {
+        r = row(rng);
+        c = column(rng);
+      }
+      const bool inside = r >= 0 && r < spec.rows && c >= 0 && c < spec.columns;
+      const int roll = std::uniform_int_distribution<int>(0, 99)(rng);
+      int type;
+      if (!inside || roll < 3) {
+        type = static_cast<int>(rng() % 3);  // anything, including a losing move
+      } else if (reference.visited(r, c)) {
+        type = 2;
+      } else {
+        type = reference.mine(r, c) ? 1 : 0;
+      }
+      if (type == 0) {
+        server.VisitBlock(r, c);
+        large.VisitBlock(r, c);
+        reference.VisitBlock(r, c);
+      } else if (type == 1) {
+        server.MarkMine(r, c);
+        large.MarkMine(r, c);
+        reference.MarkMine(r, c);
+      } else {
+        server.AutoExplore(r, c);
+        large.AutoExplore(r, c);
+        reference.AutoExplore(r, c);
+      }
+      if (!Agrees(server, reference, "GameServer", game, step) ||
+          !Agrees(large, reference, "LargeGameServer", game, step)) {
+        std::cerr << "last operation " << r << " " << c << " " << type << "\n";
+        return 1;
+      }
+    }
+  }
+  std::cout << games << " games agree with the reference\n";
+  return 0;
+}